@@ -0,0 +1,505 @@
+#ifndef _BITVECTOR_H_
+#define _BITVECTOR_H_
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+
+#include "vector.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+__attribute__((target("popcnt"))) inline long long BitCountWordsPopcnt(
+    const std::uint64_t* words, int count) {
+  long long total = 0;
+
+  for (int i = 0; i < count; i++) {
+    total += std::popcount(words[i]);
+  }
+
+  return total;
+}
+
+#endif
+
+// Counts the set bits of count words, using the popcnt instruction when the
+// CPU has it even if the build does not target it.
+inline long long BitCountWords(const std::uint64_t* words, int count) {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  static const bool hardware = __builtin_cpu_supports("popcnt");
+
+  if (hardware) {
+    return BitCountWordsPopcnt(words, count);
+  }
+#endif
+
+  long long total = 0;
+
+  for (int i = 0; i < count; i++) {
+    total += std::popcount(words[i]);
+  }
+
+  return total;
+}
+
+// Flags packed 64 to a word. Bits past Size() in the last word are always
+// zero, so whole-word operations never need to mask them.
+class BitVector {
+ public:
+  class Reference {
+   private:
+    std::uint64_t* word;
+    std::uint64_t mask;
+
+   public:
+    Reference(std::uint64_t* word, std::uint64_t mask) noexcept
+        : word{word}, mask{mask} {}
+
+    operator bool() const { return (*word & mask) != 0; }
+
+    Reference& operator=(bool value) {
+      *word = value ? (*word | mask) : (*word & ~mask);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other) {
+      return *this = static_cast<bool>(other);
+    }
+
+    void Flip() { *word ^= mask; }
+  };
+
+ private:
+  static constexpr int WordBits = 64;
+  static constexpr int RankBlockWords = 8;
+
+  int size;
+  Vector<std::uint64_t> words;
+
+  // rankIndex[b] holds the number of set bits before word b * RankBlockWords.
+  // Any mutable access invalidates it.
+  Vector<int> rankIndex;
+  bool rankValid;
+
+ private:
+  static int WordCount(int bits);
+  void ClearUnusedBits();
+  void Invalidate();
+
+ public:
+  BitVector() noexcept;
+  BitVector(int size, bool value = false) noexcept;
+  BitVector(const std::initializer_list<bool>&) noexcept;
+
+  int Size() const;
+  bool Empty() const;
+  const std::uint64_t* Words() const;
+  int WordCount() const;
+
+  void PushBack(bool value);
+  void PopBack();
+  void Resize(int newSize, bool value = false);
+  void Reserve(int bitsToReserve);
+  void Clear();
+
+  bool Test(int index) const;
+  void Set(int index, bool value = true);
+  void Reset(int index);
+  void Flip(int index);
+  void SetAll();
+  void ResetAll();
+
+  int Count() const;
+  bool Any() const;
+  bool None() const;
+  bool All() const;
+  int FindFirst() const;
+  int FindNext(int index) const;
+
+  template <typename Function>
+  void ForEachSetBit(Function&& function) const;
+
+  void BuildRankIndex();
+  int Rank(int index) const;
+  int Select(int rank) const;
+
+  BitVector& operator&=(const BitVector& other);
+  BitVector& operator|=(const BitVector& other);
+  BitVector& operator^=(const BitVector& other);
+  BitVector& AndNot(const BitVector& other);
+
+  bool operator[](int index) const;
+  Reference operator[](int index);
+  bool operator==(const BitVector& other) const;
+};
+
+inline BitVector::BitVector() noexcept : size{0}, rankValid{false} {}
+
+inline BitVector::BitVector(int size, bool value) noexcept
+    : size{size},
+      words(WordCount(size), value ? ~std::uint64_t(0) : 0),
+      rankValid{false} {
+  this->ClearUnusedBits();
+}
+
+inline BitVector::BitVector(
+    const std::initializer_list<bool>& initList) noexcept
+    : BitVector(static_cast<int>(initList.size())) {
+  int index = 0;
+
+  for (bool value : initList) {
+    this->Set(index++, value);
+  }
+}
+
+inline int BitVector::WordCount(int bits) {
+  return (bits + WordBits - 1) / WordBits;
+}
+
+inline void BitVector::ClearUnusedBits() {
+  int used = size % WordBits;
+
+  if (used != 0) {
+    words.Back() &= (std::uint64_t(1) << used) - 1;
+  }
+}
+
+inline void BitVector::Invalidate() {
+  this->rankValid = false;
+}
+
+inline int BitVector::Size() const {
+  return this->size;
+}
+
+inline bool BitVector::Empty() const {
+  return size == 0;
+}
+
+inline const std::uint64_t* BitVector::Words() const {
+  return words.Data();
+}
+
+inline int BitVector::WordCount() const {
+  return words.Size();
+}
+
+inline void BitVector::PushBack(bool value) {
+  this->Invalidate();
+
+  if (size % WordBits == 0) {
+    words.PushBack(0);
+  }
+
+  this->size++;
+  this->Set(size - 1, value);
+}
+
+inline void BitVector::PopBack() {
+  assert(size > 0);
+  this->Reset(size - 1);
+  this->size--;
+
+  if (size % WordBits == 0) {
+    words.PopBack();
+  }
+}
+
+inline void BitVector::Resize(int newSize, bool value) {
+  assert(newSize >= 0);
+  this->Invalidate();
+
+  if (newSize < size) {
+    this->size = newSize;
+
+    while (words.Size() > WordCount(newSize)) {
+      words.PopBack();
+    }
+
+    this->ClearUnusedBits();
+    return;
+  }
+
+  int oldSize = size;
+  words.Reserve(WordCount(newSize));
+
+  while (words.Size() < WordCount(newSize)) {
+    words.PushBack(value ? ~std::uint64_t(0) : 0);
+  }
+
+  this->size = newSize;
+
+  if (value) {
+    for (int i = oldSize; i < newSize && i % WordBits != 0; i++) {
+      this->Set(i);
+    }
+  }
+
+  this->ClearUnusedBits();
+}
+
+inline void BitVector::Reserve(int bitsToReserve) {
+  words.Reserve(WordCount(bitsToReserve));
+}
+
+inline void BitVector::Clear() {
+  this->Invalidate();
+  words.Clear();
+  this->size = 0;
+}
+
+inline bool BitVector::Test(int index) const {
+  assert(index >= 0);
+  assert(index < size);
+  return (words[index / WordBits] >> (index % WordBits)) & 1;
+}
+
+inline void BitVector::Set(int index, bool value) {
+  assert(index >= 0);
+  assert(index < size);
+  this->Invalidate();
+  std::uint64_t mask = std::uint64_t(1) << (index % WordBits);
+  std::uint64_t& word = words[index / WordBits];
+  word = value ? (word | mask) : (word & ~mask);
+}
+
+inline void BitVector::Reset(int index) {
+  this->Set(index, false);
+}
+
+inline void BitVector::Flip(int index) {
+  assert(index >= 0);
+  assert(index < size);
+  this->Invalidate();
+  words[index / WordBits] ^= std::uint64_t(1) << (index % WordBits);
+}
+
+inline void BitVector::SetAll() {
+  this->Invalidate();
+  words.Fill(~std::uint64_t(0));
+  this->ClearUnusedBits();
+}
+
+inline void BitVector::ResetAll() {
+  this->Invalidate();
+  words.Fill(0);
+}
+
+inline int BitVector::Count() const {
+  return static_cast<int>(BitCountWords(words.Data(), words.Size()));
+}
+
+inline bool BitVector::Any() const {
+  for (int i = 0; i < words.Size(); i++) {
+    if (words[i] != 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline bool BitVector::None() const {
+  return !this->Any();
+}
+
+inline bool BitVector::All() const {
+  return this->Count() == size;
+}
+
+inline int BitVector::FindFirst() const {
+  return this->FindNext(-1);
+}
+
+inline int BitVector::FindNext(int index) const {
+  // Returns the first set bit after index, or -1 when there is none.
+  int next = index + 1;
+
+  if (next >= size) {
+    return -1;
+  }
+
+  int wordIndex = next / WordBits;
+  std::uint64_t word =
+      words[wordIndex] & (~std::uint64_t(0) << (next % WordBits));
+
+  while (word == 0) {
+    if (++wordIndex == words.Size()) {
+      return -1;
+    }
+
+    word = words[wordIndex];
+  }
+
+  return wordIndex * WordBits + std::countr_zero(word);
+}
+
+template <typename Function>
+void BitVector::ForEachSetBit(Function&& function) const {
+  for (int i = 0; i < words.Size(); i++) {
+    std::uint64_t word = words[i];
+
+    while (word != 0) {
+      function(i * WordBits + std::countr_zero(word));
+      word &= word - 1;
+    }
+  }
+}
+
+inline void BitVector::BuildRankIndex() {
+  int blocks = (words.Size() + RankBlockWords - 1) / RankBlockWords;
+  Vector<int> index;
+  index.Reserve(blocks);
+
+  int total = 0;
+
+  for (int block = 0; block < blocks; block++) {
+    index.PushBack(total);
+    int first = block * RankBlockWords;
+    int count = words.Size() - first < RankBlockWords ? words.Size() - first
+                                                      : RankBlockWords;
+    total += static_cast<int>(BitCountWords(words.Data() + first, count));
+  }
+
+  this->rankIndex = std::move(index);
+  this->rankValid = true;
+}
+
+inline int BitVector::Rank(int index) const {
+  // Number of set bits in [0, index). Uses the rank index when it is current,
+  // otherwise counts from the start.
+  assert(index >= 0);
+  assert(index <= size);
+  int wordIndex = index / WordBits;
+  int rank = 0;
+  int first = 0;
+
+  if (rankValid && rankIndex.Size() > 0) {
+    int block = wordIndex / RankBlockWords;
+
+    if (block < rankIndex.Size()) {
+      rank = rankIndex[block];
+      first = block * RankBlockWords;
+    } else {
+      rank = rankIndex.Back();
+      first = (rankIndex.Size() - 1) * RankBlockWords;
+    }
+  }
+
+  rank += static_cast<int>(
+      BitCountWords(words.Data() + first, wordIndex - first));
+
+  if (index % WordBits != 0) {
+    std::uint64_t mask = (std::uint64_t(1) << (index % WordBits)) - 1;
+    rank += std::popcount(words[wordIndex] & mask);
+  }
+
+  return rank;
+}
+
+inline int BitVector::Select(int rank) const {
+  // Position of the set bit with the given zero-based rank, or -1 when fewer
+  // bits are set.
+  assert(rank >= 0);
+  int wordIndex = 0;
+  int remaining = rank;
+
+  if (rankValid && rankIndex.Size() > 0) {
+    int low = 0;
+    int high = rankIndex.Size() - 1;
+
+    while (low < high) {
+      int middle = low + (high - low + 1) / 2;
+
+      if (rankIndex[middle] <= rank) {
+        low = middle;
+      } else {
+        high = middle - 1;
+      }
+    }
+
+    wordIndex = low * RankBlockWords;
+    remaining = rank - rankIndex[low];
+  }
+
+  for (; wordIndex < words.Size(); wordIndex++) {
+    int count = std::popcount(words[wordIndex]);
+
+    if (remaining < count) {
+      std::uint64_t word = words[wordIndex];
+
+      for (int i = 0; i < remaining; i++) {
+        word &= word - 1;
+      }
+
+      return wordIndex * WordBits + std::countr_zero(word);
+    }
+
+    remaining -= count;
+  }
+
+  return -1;
+}
+
+inline BitVector& BitVector::operator&=(const BitVector& other) {
+  assert(size == other.size);
+  this->Invalidate();
+
+  for (int i = 0; i < words.Size(); i++) {
+    words[i] &= other.words[i];
+  }
+
+  return *this;
+}
+
+inline BitVector& BitVector::operator|=(const BitVector& other) {
+  assert(size == other.size);
+  this->Invalidate();
+
+  for (int i = 0; i < words.Size(); i++) {
+    words[i] |= other.words[i];
+  }
+
+  return *this;
+}
+
+inline BitVector& BitVector::operator^=(const BitVector& other) {
+  assert(size == other.size);
+  this->Invalidate();
+
+  for (int i = 0; i < words.Size(); i++) {
+    words[i] ^= other.words[i];
+  }
+
+  return *this;
+}
+
+inline BitVector& BitVector::AndNot(const BitVector& other) {
+  assert(size == other.size);
+  this->Invalidate();
+
+  for (int i = 0; i < words.Size(); i++) {
+    words[i] &= ~other.words[i];
+  }
+
+  return *this;
+}
+
+inline bool BitVector::operator[](int index) const {
+  return this->Test(index);
+}
+
+inline BitVector::Reference BitVector::operator[](int index) {
+  assert(index >= 0);
+  assert(index < size);
+  this->Invalidate();
+  return Reference(&words[index / WordBits],
+                   std::uint64_t(1) << (index % WordBits));
+}
+
+inline bool BitVector::operator==(const BitVector& other) const {
+  return size == other.size && words == other.words;
+}
+
+#endif  // _BITVECTOR_H_
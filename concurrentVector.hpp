@@ -0,0 +1,226 @@
+#ifndef _CONCURRENTVECTOR_H_
+#define _CONCURRENTVECTOR_H_
+
+#include <atomic>
+#include <cassert>
+#include <utility>
+
+#include "segmentedVector.hpp"
+
+template <typename T, int FirstSegmentSize = 64>
+class ConcurrentVector {
+ public:
+  using ValueType = T;
+  using PointerType = T*;
+  using ConstPointer = const T*;
+  using ReferenceType = T&;
+  using ConstReferenceType = const T&;
+
+ private:
+  using Layout = SegmentedVector<T, FirstSegmentSize>;
+
+  struct Segment {
+    T* data;
+    std::atomic<bool>* published;
+  };
+
+  std::atomic<Segment*> segments[Layout::MaxBlocks];
+  std::atomic<int> reserved;
+  std::atomic<int> size;
+
+ private:
+  Segment* AcquireSegment(int segment);
+  void AdvanceSize();
+
+ public:
+  ConcurrentVector() noexcept;
+  ConcurrentVector(const ConcurrentVector&) = delete;
+  ~ConcurrentVector() noexcept;
+
+  int PushBack(const T&);
+  int PushBack(T&&);
+
+  template <typename... Args>
+  int EmplaceBack(Args&&... args);
+
+  int Size() const;
+  bool Empty() const;
+  void Reserve(int sizeToReserve);
+  void Clear();
+  const T& At(int index) const;
+  T& At(int index);
+
+  template <typename Function>
+  void ForEach(Function&& function) const;
+
+  const T& operator[](int index) const;
+  T& operator[](int index);
+
+  ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+};
+
+template <typename T, int FirstSegmentSize>
+ConcurrentVector<T, FirstSegmentSize>::ConcurrentVector() noexcept
+    : reserved{0}, size{0} {
+  for (std::atomic<Segment*>& segment : segments) {
+    segment.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+template <typename T, int FirstSegmentSize>
+ConcurrentVector<T, FirstSegmentSize>::~ConcurrentVector() noexcept {
+  this->Clear();
+}
+
+template <typename T, int FirstSegmentSize>
+typename ConcurrentVector<T, FirstSegmentSize>::Segment*
+ConcurrentVector<T, FirstSegmentSize>::AcquireSegment(int segment) {
+  assert(segment < Layout::MaxBlocks);
+  Segment* current = segments[segment].load(std::memory_order_acquire);
+
+  if (current != nullptr) {
+    return current;
+  }
+
+  int segmentSize = Layout::BlockSize(segment);
+  Segment* allocated =
+      new Segment{new T[segmentSize], new std::atomic<bool>[segmentSize]()};
+
+  if (segments[segment].compare_exchange_strong(current, allocated,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+    return allocated;
+  }
+
+  delete[] allocated->data;
+  delete[] allocated->published;
+  delete allocated;
+  return current;
+}
+
+template <typename T, int FirstSegmentSize>
+void ConcurrentVector<T, FirstSegmentSize>::AdvanceSize() {
+  // Any writer may move the published prefix forward past slots other writers
+  // finished, so Size() never waits on a stalled thread's later slots. The
+  // flag accesses are sequentially consistent so that of two writers finishing
+  // neighbouring slots at once, at least one sees the other's flag.
+  int current = size.load();
+
+  while (current < reserved.load()) {
+    int segment = Layout::BlockOf(current);
+    Segment* owner = segments[segment].load(std::memory_order_acquire);
+
+    if (owner == nullptr ||
+        !owner->published[Layout::OffsetOf(current, segment)].load()) {
+      return;
+    }
+
+    if (size.compare_exchange_weak(current, current + 1)) {
+      current++;
+    }
+  }
+}
+
+template <typename T, int FirstSegmentSize>
+int ConcurrentVector<T, FirstSegmentSize>::PushBack(const T& newData) {
+  return this->EmplaceBack(newData);
+}
+
+template <typename T, int FirstSegmentSize>
+int ConcurrentVector<T, FirstSegmentSize>::PushBack(T&& newData) {
+  return this->EmplaceBack(std::move(newData));
+}
+
+template <typename T, int FirstSegmentSize>
+template <typename... Args>
+int ConcurrentVector<T, FirstSegmentSize>::EmplaceBack(Args&&... args) {
+  int index = reserved.fetch_add(1, std::memory_order_relaxed);
+  int segment = Layout::BlockOf(index);
+  int offset = Layout::OffsetOf(index, segment);
+  Segment* owner = this->AcquireSegment(segment);
+
+  owner->data[offset] = T(std::forward<Args>(args)...);
+  owner->published[offset].store(true);
+  this->AdvanceSize();
+  return index;
+}
+
+template <typename T, int FirstSegmentSize>
+int ConcurrentVector<T, FirstSegmentSize>::Size() const {
+  return size.load(std::memory_order_acquire);
+}
+
+template <typename T, int FirstSegmentSize>
+bool ConcurrentVector<T, FirstSegmentSize>::Empty() const {
+  return this->Size() == 0;
+}
+
+template <typename T, int FirstSegmentSize>
+void ConcurrentVector<T, FirstSegmentSize>::Reserve(int sizeToReserve) {
+  if (sizeToReserve <= 0) {
+    return;
+  }
+
+  int lastSegment = Layout::BlockOf(sizeToReserve - 1);
+
+  for (int segment = 0; segment <= lastSegment; segment++) {
+    this->AcquireSegment(segment);
+  }
+}
+
+template <typename T, int FirstSegmentSize>
+void ConcurrentVector<T, FirstSegmentSize>::Clear() {
+  for (std::atomic<Segment*>& segment : segments) {
+    Segment* owner = segment.exchange(nullptr, std::memory_order_acq_rel);
+
+    if (owner != nullptr) {
+      delete[] owner->data;
+      delete[] owner->published;
+      delete owner;
+    }
+  }
+
+  reserved.store(0);
+  size.store(0);
+}
+
+template <typename T, int FirstSegmentSize>
+const T& ConcurrentVector<T, FirstSegmentSize>::operator[](int index) const {
+  assert(index >= 0);
+  assert(index < this->Size());
+  int segment = Layout::BlockOf(index);
+  Segment* owner = segments[segment].load(std::memory_order_acquire);
+  return owner->data[Layout::OffsetOf(index, segment)];
+}
+
+template <typename T, int FirstSegmentSize>
+T& ConcurrentVector<T, FirstSegmentSize>::operator[](int index) {
+  assert(index >= 0);
+  assert(index < this->Size());
+  int segment = Layout::BlockOf(index);
+  Segment* owner = segments[segment].load(std::memory_order_acquire);
+  return owner->data[Layout::OffsetOf(index, segment)];
+}
+
+template <typename T, int FirstSegmentSize>
+const T& ConcurrentVector<T, FirstSegmentSize>::At(int index) const {
+  return (*this)[index];
+}
+
+template <typename T, int FirstSegmentSize>
+T& ConcurrentVector<T, FirstSegmentSize>::At(int index) {
+  return (*this)[index];
+}
+
+template <typename T, int FirstSegmentSize>
+template <typename Function>
+void ConcurrentVector<T, FirstSegmentSize>::ForEach(
+    Function&& function) const {
+  int snapshot = this->Size();
+
+  for (int i = 0; i < snapshot; i++) {
+    function((*this)[i], i);
+  }
+}
+
+#endif  // _CONCURRENTVECTOR_H_
@@ -0,0 +1,344 @@
+#ifndef _COWVECTOR_H_
+#define _COWVECTOR_H_
+
+#include <atomic>
+#include <initializer_list>
+#include <utility>
+
+#include "vector.hpp"
+
+// Copies share one buffer until one of them is modified. Elements are only
+// ever handed out as const, and every change goes through a member that
+// takes the new value, so no reference can outlive a detach and write into
+// a buffer another copy has since come to share.
+template <typename T>
+class CowVector {
+ public:
+  using ValueType = T;
+  using PointerType = T*;
+  using ConstPointer = const T*;
+  using ReferenceType = T&;
+  using ConstReferenceType = const T&;
+  using ConstIterator = typename Vector<T>::ConstIterator;
+
+ private:
+  struct Buffer {
+    std::atomic<int> references;
+    Vector<T> vector;
+  };
+
+  Buffer* buffer;
+
+ private:
+  static Buffer* EmptyBuffer();
+  void Acquire(Buffer* sharedBuffer);
+  void Release();
+  void Detach();
+
+ public:
+  CowVector() noexcept;
+  CowVector(const std::initializer_list<T>&) noexcept;
+  CowVector(const Vector<T>&) noexcept;
+  CowVector(Vector<T>&&) noexcept;
+  CowVector(const CowVector<T>&) noexcept;
+  CowVector(CowVector<T>&&) noexcept;
+  ~CowVector() noexcept;
+
+  int Size() const;
+  int Capacity() const;
+  bool Empty() const;
+  int UseCount() const;
+  bool Shared() const;
+  const T& Front() const;
+  const T& Back() const;
+  const T& At(int index) const;
+  const T* Data() const;
+  const T* Find(const T&) const;
+  int IndexOf(const T&) const;
+  const Vector<T>& Read() const;
+
+  void Set(int index, const T& newData);
+  void Set(int index, T&& newData);
+  void PushBack(const T&);
+  void PushBack(T&&);
+  void PopBack();
+  void Insert(int index, const T& newData);
+  void Erase(int index);
+  void Reserve(int sizeToReserve);
+  void Clear();
+  void Sort();
+  void Reverse();
+  void Swap(CowVector<T>&) noexcept;
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+
+  ConstIterator begin() const { return buffer->vector.cbegin(); }
+
+  ConstIterator end() const { return buffer->vector.cend(); }
+
+  bool operator==(const CowVector<T>&) const;
+  bool operator!=(const CowVector<T>&) const;
+
+  const T& operator[](int index) const;
+
+  CowVector<T>& operator=(const CowVector<T>& otherVector) noexcept;
+  CowVector<T>& operator=(CowVector<T>&& otherVector) noexcept;
+};
+
+template <typename T>
+typename CowVector<T>::Buffer* CowVector<T>::EmptyBuffer() {
+  static Buffer empty{1, Vector<T>()};
+  return &empty;
+}
+
+template <typename T>
+void CowVector<T>::Acquire(Buffer* sharedBuffer) {
+  sharedBuffer->references.fetch_add(1, std::memory_order_relaxed);
+  this->buffer = sharedBuffer;
+}
+
+template <typename T>
+void CowVector<T>::Release() {
+  if (buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete buffer;
+  }
+
+  buffer = nullptr;
+}
+
+template <typename T>
+void CowVector<T>::Detach() {
+  if (buffer->references.load(std::memory_order_acquire) == 1) {
+    return;
+  }
+
+  Buffer* copy = new Buffer{1, buffer->vector};
+  this->Release();
+  this->buffer = copy;
+}
+
+template <typename T>
+CowVector<T>::CowVector() noexcept : buffer{nullptr} {
+  this->Acquire(EmptyBuffer());
+}
+
+template <typename T>
+CowVector<T>::CowVector(const std::initializer_list<T>& initList) noexcept
+    : buffer{new Buffer{1, Vector<T>(initList)}} {}
+
+template <typename T>
+CowVector<T>::CowVector(const Vector<T>& vector) noexcept
+    : buffer{new Buffer{1, vector}} {}
+
+template <typename T>
+CowVector<T>::CowVector(Vector<T>&& vector) noexcept
+    : buffer{new Buffer{1, std::move(vector)}} {}
+
+template <typename T>
+CowVector<T>::CowVector(const CowVector<T>& otherVector) noexcept
+    : buffer{nullptr} {
+  this->Acquire(otherVector.buffer);
+}
+
+template <typename T>
+CowVector<T>::CowVector(CowVector<T>&& otherVector) noexcept
+    : buffer{otherVector.buffer} {
+  otherVector.buffer = nullptr;
+  otherVector.Acquire(EmptyBuffer());
+}
+
+template <typename T>
+CowVector<T>::~CowVector() noexcept {
+  if (buffer != nullptr) {
+    this->Release();
+  }
+}
+
+template <typename T>
+CowVector<T>& CowVector<T>::operator=(const CowVector<T>& otherVector) noexcept {
+  if (this->buffer == otherVector.buffer) {
+    return *this;
+  }
+
+  this->Release();
+  this->Acquire(otherVector.buffer);
+  return *this;
+}
+
+template <typename T>
+CowVector<T>& CowVector<T>::operator=(CowVector<T>&& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  this->Release();
+  this->buffer = otherVector.buffer;
+  otherVector.buffer = nullptr;
+  otherVector.Acquire(EmptyBuffer());
+  return *this;
+}
+
+template <typename T>
+bool CowVector<T>::operator==(const CowVector<T>& otherVector) const {
+  if (this->buffer == otherVector.buffer) {
+    return true;
+  }
+
+  return buffer->vector == otherVector.buffer->vector;
+}
+
+template <typename T>
+bool CowVector<T>::operator!=(const CowVector<T>& otherVector) const {
+  return !(*this == otherVector);
+}
+
+template <typename T>
+const T& CowVector<T>::operator[](int index) const {
+  return buffer->vector[index];
+}
+
+template <typename T>
+int CowVector<T>::Size() const {
+  return buffer->vector.Size();
+}
+
+template <typename T>
+int CowVector<T>::Capacity() const {
+  return buffer->vector.Capacity();
+}
+
+template <typename T>
+bool CowVector<T>::Empty() const {
+  return buffer->vector.Empty();
+}
+
+template <typename T>
+int CowVector<T>::UseCount() const {
+  return buffer->references.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+bool CowVector<T>::Shared() const {
+  return this->UseCount() > 1;
+}
+
+template <typename T>
+const T& CowVector<T>::Front() const {
+  return buffer->vector.Front();
+}
+
+template <typename T>
+const T& CowVector<T>::Back() const {
+  return buffer->vector.Back();
+}
+
+template <typename T>
+const T& CowVector<T>::At(int index) const {
+  return buffer->vector.At(index);
+}
+
+template <typename T>
+const T* CowVector<T>::Data() const {
+  return buffer->vector.Data();
+}
+
+template <typename T>
+const T* CowVector<T>::Find(const T& dataToFind) const {
+  return buffer->vector.Find(dataToFind);
+}
+
+template <typename T>
+int CowVector<T>::IndexOf(const T& dataToFind) const {
+  return buffer->vector.IndexOf(dataToFind);
+}
+
+template <typename T>
+const Vector<T>& CowVector<T>::Read() const {
+  return buffer->vector;
+}
+
+template <typename T>
+void CowVector<T>::Set(int index, const T& newData) {
+  this->Detach();
+  buffer->vector[index] = newData;
+}
+
+template <typename T>
+void CowVector<T>::Set(int index, T&& newData) {
+  this->Detach();
+  buffer->vector[index] = std::move(newData);
+}
+
+template <typename T>
+void CowVector<T>::PushBack(const T& newData) {
+  this->Detach();
+  buffer->vector.PushBack(newData);
+}
+
+template <typename T>
+void CowVector<T>::PushBack(T&& newData) {
+  this->Detach();
+  buffer->vector.PushBack(std::move(newData));
+}
+
+template <typename T>
+template <typename... Args>
+void CowVector<T>::EmplaceBack(Args&&... args) {
+  this->Detach();
+  buffer->vector.EmplaceBack(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void CowVector<T>::PopBack() {
+  this->Detach();
+  buffer->vector.PopBack();
+}
+
+template <typename T>
+void CowVector<T>::Insert(int index, const T& newData) {
+  this->Detach();
+  buffer->vector.Insert(index, newData);
+}
+
+template <typename T>
+void CowVector<T>::Erase(int index) {
+  this->Detach();
+  buffer->vector.Erase(index);
+}
+
+template <typename T>
+void CowVector<T>::Reserve(int sizeToReserve) {
+  this->Detach();
+  buffer->vector.Reserve(sizeToReserve);
+}
+
+template <typename T>
+void CowVector<T>::Clear() {
+  if (this->Shared()) {
+    this->Release();
+    this->Acquire(EmptyBuffer());
+    return;
+  }
+
+  buffer->vector.Clear();
+}
+
+template <typename T>
+void CowVector<T>::Sort() {
+  this->Detach();
+  buffer->vector.Sort();
+}
+
+template <typename T>
+void CowVector<T>::Reverse() {
+  this->Detach();
+  buffer->vector.Reverse();
+}
+
+template <typename T>
+void CowVector<T>::Swap(CowVector<T>& otherVector) noexcept {
+  std::swap(this->buffer, otherVector.buffer);
+}
+
+#endif  // _COWVECTOR_H_
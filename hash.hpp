@@ -0,0 +1,103 @@
+#ifndef _HASH_H_
+#define _HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+__extension__ typedef unsigned __int128 HashUint128;
+
+inline constexpr std::uint64_t HashSecret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL,
+    0x4d5a2da51de1aa47ULL};
+
+inline std::uint64_t HashRead64(const unsigned char* bytes) {
+  std::uint64_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+inline std::uint64_t HashRead32(const unsigned char* bytes) {
+  std::uint32_t value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+// Folds the 128 bit product of a and b into 64 bits.
+inline std::uint64_t HashMix(std::uint64_t a, std::uint64_t b) {
+  HashUint128 product = static_cast<HashUint128>(a) * b;
+  return static_cast<std::uint64_t>(product) ^
+         static_cast<std::uint64_t>(product >> 64);
+}
+
+inline std::uint64_t HashCombine(std::uint64_t seed, std::uint64_t value) {
+  return HashMix(seed ^ HashSecret[0], value ^ HashSecret[1]);
+}
+
+// wyhash over raw bytes. Inputs longer than 48 bytes are consumed by three
+// independent multiply lanes, so the loop is limited by multiplier throughput
+// rather than by one long dependency chain.
+inline std::uint64_t HashBytes(const void* key, std::size_t length,
+                               std::uint64_t seed = 0) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(key);
+  std::uint64_t a;
+  std::uint64_t b;
+
+  seed ^= HashMix(seed ^ HashSecret[0], HashSecret[1]);
+
+  if (length <= 16) {
+    if (length >= 4) {
+      std::size_t middle = (length >> 3) << 2;
+      a = (HashRead32(bytes) << 32) | HashRead32(bytes + middle);
+      b = (HashRead32(bytes + length - 4) << 32) |
+          HashRead32(bytes + length - 4 - middle);
+    } else if (length > 0) {
+      a = (static_cast<std::uint64_t>(bytes[0]) << 16) |
+          (static_cast<std::uint64_t>(bytes[length >> 1]) << 8) |
+          bytes[length - 1];
+      b = 0;
+    } else {
+      a = 0;
+      b = 0;
+    }
+  } else {
+    std::size_t remaining = length;
+
+    if (remaining > 48) {
+      std::uint64_t lane1 = seed;
+      std::uint64_t lane2 = seed;
+
+      do {
+        seed = HashMix(HashRead64(bytes) ^ HashSecret[1],
+                       HashRead64(bytes + 8) ^ seed);
+        lane1 = HashMix(HashRead64(bytes + 16) ^ HashSecret[2],
+                        HashRead64(bytes + 24) ^ lane1);
+        lane2 = HashMix(HashRead64(bytes + 32) ^ HashSecret[3],
+                        HashRead64(bytes + 40) ^ lane2);
+        bytes += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+
+      seed ^= lane1 ^ lane2;
+    }
+
+    while (remaining > 16) {
+      seed = HashMix(HashRead64(bytes) ^ HashSecret[1],
+                     HashRead64(bytes + 8) ^ seed);
+      bytes += 16;
+      remaining -= 16;
+    }
+
+    a = HashRead64(bytes + remaining - 16);
+    b = HashRead64(bytes + remaining - 8);
+  }
+
+  HashUint128 product =
+      static_cast<HashUint128>(a ^ HashSecret[1]) * (b ^ seed);
+  a = static_cast<std::uint64_t>(product);
+  b = static_cast<std::uint64_t>(product >> 64);
+
+  return HashMix(a ^ HashSecret[0] ^ length, b ^ HashSecret[1]);
+}
+
+#endif  // _HASH_H_
@@ -0,0 +1,492 @@
+#ifndef _INCREMENTALVECTOR_H_
+#define _INCREMENTALVECTOR_H_
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename T, int MigrationStep = 64>
+class IncrementalVector {
+  static_assert(MigrationStep > 0, "MigrationStep must be positive.");
+
+ public:
+  using ValueType = T;
+  using PointerType = T*;
+  using ConstPointer = const T*;
+  using ReferenceType = T&;
+  using ConstReferenceType = const T&;
+
+  template <bool Const>
+  class BasicIterator {
+   private:
+    using Owner =
+        std::conditional_t<Const, const IncrementalVector, IncrementalVector>;
+
+    Owner* vector;
+    int index;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    BasicIterator() noexcept : vector{nullptr}, index{0} {}
+
+    BasicIterator(Owner* vector, int index) noexcept
+        : vector{vector}, index{index} {}
+
+    BasicIterator& operator++() noexcept {
+      index++;
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator iterator(*this);
+      index++;
+      return iterator;
+    }
+
+    pointer operator->() const { return &(*vector)[index]; }
+
+    reference operator*() const { return (*vector)[index]; }
+
+    bool operator==(const BasicIterator& other) const {
+      return index == other.index;
+    }
+  };
+
+  using Iterator = BasicIterator<false>;
+  using ConstIterator = BasicIterator<true>;
+
+ private:
+  int size;
+  int capacity;
+  T* data;
+
+  // While a growth is being migrated, the elements in [migrated, oldSize)
+  // still live in oldData; every other element lives in data. Both buffers
+  // are raw storage and only the slots holding elements are constructed, so
+  // growing costs one allocation and each migration step moves and destroys
+  // at most MigrationStep elements.
+  T* oldData;
+  int oldCapacity;
+  int oldSize;
+  int migrated;
+
+ private:
+  static T* Allocate(int count);
+  static void Deallocate(T* buffer, int count);
+  void Grow();
+  void Reallocate(int desiredCapacity);
+
+ public:
+  IncrementalVector() noexcept;
+  IncrementalVector(const std::initializer_list<T>&) noexcept;
+  IncrementalVector(const IncrementalVector&) noexcept;
+  IncrementalVector(IncrementalVector&&) noexcept;
+  ~IncrementalVector() noexcept;
+
+  void PushBack(const T&);
+  void PushBack(T&&);
+  void PopBack();
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+
+  int Size() const;
+  int Capacity() const;
+  bool Empty() const;
+  bool Migrating() const;
+  int PendingMigration() const;
+  void Migrate(int count);
+  void FinishMigration();
+  void Reserve(int sizeToReserve);
+  void ShrinkToFit();
+  void Clear();
+  T& Front();
+  T& Back();
+  const T& Front() const;
+  const T& Back() const;
+  T& At(int index);
+  const T& At(int index) const;
+  T* Data();
+
+  Iterator begin() { return Iterator(this, 0); }
+
+  Iterator end() { return Iterator(this, size); }
+
+  ConstIterator begin() const { return ConstIterator(this, 0); }
+
+  ConstIterator end() const { return ConstIterator(this, size); }
+
+  const T& operator[](int index) const;
+  T& operator[](int index);
+
+  IncrementalVector& operator=(const IncrementalVector& otherVector) noexcept;
+  IncrementalVector& operator=(IncrementalVector&& otherVector) noexcept;
+};
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>::IncrementalVector() noexcept
+    : size{0},
+      capacity{0},
+      data{nullptr},
+      oldData{nullptr},
+      oldCapacity{0},
+      oldSize{0},
+      migrated{0} {}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>::IncrementalVector(
+    const std::initializer_list<T>& initList) noexcept
+    : IncrementalVector() {
+  this->Reserve(static_cast<int>(initList.size()));
+
+  for (const T& element : initList) {
+    this->PushBack(element);
+  }
+}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>::IncrementalVector(
+    const IncrementalVector& otherVector) noexcept
+    : IncrementalVector() {
+  this->Reserve(otherVector.size);
+
+  for (int i = 0; i < otherVector.size; i++) {
+    this->PushBack(otherVector[i]);
+  }
+}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>::IncrementalVector(
+    IncrementalVector&& otherVector) noexcept
+    : size{otherVector.size},
+      capacity{otherVector.capacity},
+      data{otherVector.data},
+      oldData{otherVector.oldData},
+      oldCapacity{otherVector.oldCapacity},
+      oldSize{otherVector.oldSize},
+      migrated{otherVector.migrated} {
+  otherVector.size = 0;
+  otherVector.capacity = 0;
+  otherVector.data = nullptr;
+  otherVector.oldData = nullptr;
+  otherVector.oldCapacity = 0;
+  otherVector.oldSize = 0;
+  otherVector.migrated = 0;
+}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>::~IncrementalVector() noexcept {
+  this->Clear();
+}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>&
+IncrementalVector<T, MigrationStep>::operator=(
+    const IncrementalVector& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  IncrementalVector copy(otherVector);
+  *this = std::move(copy);
+  return *this;
+}
+
+template <typename T, int MigrationStep>
+IncrementalVector<T, MigrationStep>&
+IncrementalVector<T, MigrationStep>::operator=(
+    IncrementalVector&& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  this->Clear();
+  this->size = otherVector.size;
+  this->capacity = otherVector.capacity;
+  this->data = otherVector.data;
+  this->oldData = otherVector.oldData;
+  this->oldCapacity = otherVector.oldCapacity;
+  this->oldSize = otherVector.oldSize;
+  this->migrated = otherVector.migrated;
+  otherVector.size = 0;
+  otherVector.capacity = 0;
+  otherVector.data = nullptr;
+  otherVector.oldData = nullptr;
+  otherVector.oldCapacity = 0;
+  otherVector.oldSize = 0;
+  otherVector.migrated = 0;
+  return *this;
+}
+
+template <typename T, int MigrationStep>
+const T& IncrementalVector<T, MigrationStep>::operator[](int index) const {
+  assert(index >= 0);
+  assert(index < size);
+
+  if (index >= migrated && index < oldSize) {
+    return oldData[index];
+  }
+
+  return data[index];
+}
+
+template <typename T, int MigrationStep>
+T& IncrementalVector<T, MigrationStep>::operator[](int index) {
+  assert(index >= 0);
+  assert(index < size);
+
+  if (index >= migrated && index < oldSize) {
+    return oldData[index];
+  }
+
+  return data[index];
+}
+
+template <typename T, int MigrationStep>
+T* IncrementalVector<T, MigrationStep>::Allocate(int count) {
+  return count > 0 ? std::allocator<T>().allocate(count) : nullptr;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Deallocate(T* buffer, int count) {
+  if (buffer != nullptr) {
+    std::allocator<T>().deallocate(buffer, count);
+  }
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Grow() {
+  // Doubling leaves as many free slots as there are elements to migrate, so
+  // with MigrationStep >= 1 the migration always finishes before the next
+  // growth.
+  this->FinishMigration();
+
+  int newCapacity = capacity == 0 ? 1 : capacity * 2;
+
+  this->oldData = data;
+  this->oldCapacity = capacity;
+  this->oldSize = size;
+  this->migrated = 0;
+  this->data = Allocate(newCapacity);
+  this->capacity = newCapacity;
+
+  if (oldSize == 0) {
+    Deallocate(oldData, oldCapacity);
+    this->oldData = nullptr;
+    this->oldCapacity = 0;
+  }
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Reallocate(int desiredCapacity) {
+  this->FinishMigration();
+
+  T* newData = Allocate(desiredCapacity);
+
+  for (int i = 0; i < size; i++) {
+    std::construct_at(newData + i, std::move(data[i]));
+    std::destroy_at(data + i);
+  }
+
+  Deallocate(data, capacity);
+  this->data = newData;
+  this->capacity = desiredCapacity;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Migrate(int count) {
+  if (oldData == nullptr) {
+    return;
+  }
+
+  int last = migrated + count;
+
+  if (last > oldSize) {
+    last = oldSize;
+  }
+
+  for (int i = migrated; i < last; i++) {
+    std::construct_at(data + i, std::move(oldData[i]));
+    std::destroy_at(oldData + i);
+  }
+
+  this->migrated = last;
+
+  if (migrated == oldSize) {
+    Deallocate(oldData, oldCapacity);
+    this->oldData = nullptr;
+    this->oldCapacity = 0;
+    this->oldSize = 0;
+    this->migrated = 0;
+  }
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::FinishMigration() {
+  this->Migrate(oldSize - migrated);
+}
+
+template <typename T, int MigrationStep>
+bool IncrementalVector<T, MigrationStep>::Migrating() const {
+  return oldData != nullptr;
+}
+
+template <typename T, int MigrationStep>
+int IncrementalVector<T, MigrationStep>::PendingMigration() const {
+  return oldSize - migrated;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::PushBack(const T& newData) {
+  this->Migrate(MigrationStep);
+
+  if (size == capacity) {
+    this->Grow();
+  }
+
+  std::construct_at(data + size, newData);
+  this->size++;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::PushBack(T&& newData) {
+  this->Migrate(MigrationStep);
+
+  if (size == capacity) {
+    this->Grow();
+  }
+
+  std::construct_at(data + size, std::move(newData));
+  this->size++;
+}
+
+template <typename T, int MigrationStep>
+template <typename... Args>
+void IncrementalVector<T, MigrationStep>::EmplaceBack(Args&&... args) {
+  this->Migrate(MigrationStep);
+
+  if (size == capacity) {
+    this->Grow();
+  }
+
+  std::construct_at(data + size, std::forward<Args>(args)...);
+  this->size++;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::PopBack() {
+  assert(size > 0);
+  std::destroy_at(&(*this)[size - 1]);
+  this->size--;
+
+  if (oldSize > size) {
+    this->oldSize = size;
+
+    if (migrated > oldSize) {
+      this->migrated = oldSize;
+    }
+  }
+
+  this->Migrate(MigrationStep);
+}
+
+template <typename T, int MigrationStep>
+int IncrementalVector<T, MigrationStep>::Size() const {
+  return this->size;
+}
+
+template <typename T, int MigrationStep>
+int IncrementalVector<T, MigrationStep>::Capacity() const {
+  return this->capacity;
+}
+
+template <typename T, int MigrationStep>
+bool IncrementalVector<T, MigrationStep>::Empty() const {
+  return size == 0;
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Reserve(int sizeToReserve) {
+  if (sizeToReserve <= capacity) {
+    return;
+  }
+
+  this->Reallocate(sizeToReserve);
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::ShrinkToFit() {
+  if (size == capacity) {
+    return;
+  }
+
+  this->Reallocate(size);
+}
+
+template <typename T, int MigrationStep>
+void IncrementalVector<T, MigrationStep>::Clear() {
+  for (int i = 0; i < size; i++) {
+    std::destroy_at(&(*this)[i]);
+  }
+
+  Deallocate(oldData, oldCapacity);
+  Deallocate(data, capacity);
+  this->oldData = nullptr;
+  this->oldCapacity = 0;
+  this->data = nullptr;
+  this->oldSize = 0;
+  this->migrated = 0;
+  this->size = 0;
+  this->capacity = 0;
+}
+
+template <typename T, int MigrationStep>
+T& IncrementalVector<T, MigrationStep>::Front() {
+  assert(size > 0);
+  return (*this)[0];
+}
+
+template <typename T, int MigrationStep>
+T& IncrementalVector<T, MigrationStep>::Back() {
+  assert(size > 0);
+  return (*this)[size - 1];
+}
+
+template <typename T, int MigrationStep>
+const T& IncrementalVector<T, MigrationStep>::Front() const {
+  assert(size > 0);
+  return (*this)[0];
+}
+
+template <typename T, int MigrationStep>
+const T& IncrementalVector<T, MigrationStep>::Back() const {
+  assert(size > 0);
+  return (*this)[size - 1];
+}
+
+template <typename T, int MigrationStep>
+T& IncrementalVector<T, MigrationStep>::At(int index) {
+  return (*this)[index];
+}
+
+template <typename T, int MigrationStep>
+const T& IncrementalVector<T, MigrationStep>::At(int index) const {
+  return (*this)[index];
+}
+
+template <typename T, int MigrationStep>
+T* IncrementalVector<T, MigrationStep>::Data() {
+  this->FinishMigration();
+  return data;
+}
+
+#endif  // _INCREMENTALVECTOR_H_
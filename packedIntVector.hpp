@@ -0,0 +1,381 @@
+#ifndef _PACKEDINTVECTOR_H_
+#define _PACKEDINTVECTOR_H_
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "reduce.hpp"
+#include "staticVector.hpp"
+#include "vector.hpp"
+
+// Integers compressed with frame-of-reference bit packing. Every full block of
+// BlockSize values is stored as its minimum plus the offsets from it, each
+// offset packed in just enough bits for the largest one. The block header
+// records where its bits start, so any element is reached in O(1). Values are
+// appended to an unpacked tail that is packed once it fills a block.
+template <typename T>
+class PackedIntVector {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                "PackedIntVector holds integers.");
+
+ public:
+  static constexpr int BlockSize = 128;
+
+ private:
+  using Unsigned = std::make_unsigned_t<T>;
+
+  static constexpr int WordBits = 64;
+  static constexpr int MaxBits = sizeof(T) * 8;
+
+  struct Block {
+    T reference;
+    int offset;
+    int bits;
+  };
+
+  using Unpacker = void (*)(const std::uint64_t*, T, T*);
+
+ public:
+  class ConstIterator {
+   private:
+    const PackedIntVector* vector;
+    int index;
+
+    // The block last decoded by operator*, so a scan unpacks each block once.
+    mutable int block;
+    mutable std::array<T, BlockSize> buffer;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    ConstIterator() noexcept : vector{nullptr}, index{0}, block{-1} {}
+
+    ConstIterator(const PackedIntVector* vector, int index) noexcept
+        : vector{vector}, index{index}, block{-1} {}
+
+    ConstIterator& operator++() noexcept {
+      index++;
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      ConstIterator iterator(*this);
+      ++(*this);
+      return iterator;
+    }
+
+    T operator*() const {
+      int current = index / BlockSize;
+
+      if (current == vector->blocks.Size()) {
+        return vector->tail[index % BlockSize];
+      }
+
+      if (current != block) {
+        vector->DecodeBlock(current, buffer.data());
+        this->block = current;
+      }
+
+      return buffer[index % BlockSize];
+    }
+
+    bool operator==(const ConstIterator& other) const {
+      return index == other.index;
+    }
+  };
+
+ private:
+  int size;
+  Vector<Block> blocks;
+  Vector<std::uint64_t> words;
+  StaticVector<T, BlockSize> tail;
+
+ private:
+  template <int Bits>
+  static void UnpackBlock(const std::uint64_t* packed, T reference, T* output);
+
+  template <std::size_t... Bits>
+  static constexpr std::array<Unpacker, MaxBits + 1> MakeUnpackers(
+      std::index_sequence<Bits...>);
+
+  static constexpr std::uint64_t Mask(int bits);
+  void PackTail();
+  void UnpackLastBlock();
+
+ public:
+  PackedIntVector() noexcept;
+  PackedIntVector(const std::initializer_list<T>&) noexcept;
+  explicit PackedIntVector(const Vector<T>&) noexcept;
+
+  void PushBack(T value);
+  void PopBack();
+  void Clear();
+
+  int Size() const;
+  bool Empty() const;
+  int BlockCount() const;
+  int BitsPerValue(int block) const;
+  std::size_t MemoryUsage() const;
+
+  void DecodeBlock(int block, T* output) const;
+  Vector<T> ToVector() const;
+
+  T At(int index) const;
+  T Front() const;
+  T Back() const;
+  T operator[](int index) const;
+
+  ConstIterator begin() const { return ConstIterator(this, 0); }
+
+  ConstIterator end() const { return ConstIterator(this, size); }
+};
+
+template <typename T>
+PackedIntVector<T>::PackedIntVector() noexcept : size{0} {}
+
+template <typename T>
+PackedIntVector<T>::PackedIntVector(
+    const std::initializer_list<T>& initList) noexcept
+    : size{0} {
+  for (T value : initList) {
+    this->PushBack(value);
+  }
+}
+
+template <typename T>
+PackedIntVector<T>::PackedIntVector(const Vector<T>& vector) noexcept
+    : size{0} {
+  for (int i = 0; i < vector.Size(); i++) {
+    this->PushBack(vector[i]);
+  }
+}
+
+template <typename T>
+constexpr std::uint64_t PackedIntVector<T>::Mask(int bits) {
+  return bits == 0 ? 0 : ~std::uint64_t(0) >> (WordBits - bits);
+}
+
+template <typename T>
+template <int Bits>
+void PackedIntVector<T>::UnpackBlock(const std::uint64_t* packed, T reference,
+                                     T* output) {
+  // Bits is a constant here, so every shift and word index folds away and
+  // the loop vectorizes; DecodeBlock picks the instance from a table.
+  for (int i = 0; i < BlockSize; i++) {
+    if constexpr (Bits == 0) {
+      output[i] = reference;
+    } else {
+      int position = i * Bits;
+      int word = position / WordBits;
+      int shift = position % WordBits;
+      std::uint64_t value = packed[word] >> shift;
+
+      if (shift + Bits > WordBits) {
+        value |= packed[word + 1] << (WordBits - shift);
+      }
+
+      output[i] = static_cast<T>(static_cast<Unsigned>(reference) +
+                                 static_cast<Unsigned>(value & Mask(Bits)));
+    }
+  }
+}
+
+template <typename T>
+template <std::size_t... Bits>
+constexpr std::array<typename PackedIntVector<T>::Unpacker,
+                     PackedIntVector<T>::MaxBits + 1>
+PackedIntVector<T>::MakeUnpackers(std::index_sequence<Bits...>) {
+  return {&PackedIntVector::UnpackBlock<static_cast<int>(Bits)>...};
+}
+
+template <typename T>
+void PackedIntVector<T>::PackTail() {
+  ReduceMinMax<T> range = ReduceMinMaxValuesDispatch(
+      static_cast<const T*>(tail.Data()), tail.Size());
+  int bits = std::bit_width(static_cast<Unsigned>(
+      static_cast<Unsigned>(range.max) - static_cast<Unsigned>(range.min)));
+
+  int offset = words.Size();
+  int wordCount = BlockSize * bits / WordBits;
+  words.Reserve(offset + wordCount);
+
+  for (int i = 0; i < wordCount; i++) {
+    words.PushBack(0);
+  }
+
+  std::uint64_t* packed = words.Data() + offset;
+
+  for (int i = 0; i < BlockSize && bits > 0; i++) {
+    std::uint64_t value = static_cast<Unsigned>(
+        static_cast<Unsigned>(tail[i]) - static_cast<Unsigned>(range.min));
+    int position = i * bits;
+    int word = position / WordBits;
+    int shift = position % WordBits;
+    packed[word] |= value << shift;
+
+    if (shift + bits > WordBits) {
+      packed[word + 1] |= value >> (WordBits - shift);
+    }
+  }
+
+  blocks.PushBack(Block{range.min, offset, bits});
+  tail.Clear();
+}
+
+template <typename T>
+void PackedIntVector<T>::UnpackLastBlock() {
+  T values[BlockSize];
+  this->DecodeBlock(blocks.Size() - 1, values);
+
+  Block last = blocks.Back();
+  blocks.PopBack();
+
+  while (words.Size() > last.offset) {
+    words.PopBack();
+  }
+
+  for (int i = 0; i < BlockSize; i++) {
+    tail.PushBack(values[i]);
+  }
+}
+
+template <typename T>
+void PackedIntVector<T>::PushBack(T value) {
+  tail.PushBack(value);
+  this->size++;
+
+  if (tail.Full()) {
+    this->PackTail();
+  }
+}
+
+template <typename T>
+void PackedIntVector<T>::PopBack() {
+  assert(size > 0);
+
+  if (tail.Empty()) {
+    this->UnpackLastBlock();
+  }
+
+  tail.PopBack();
+  this->size--;
+}
+
+template <typename T>
+void PackedIntVector<T>::Clear() {
+  blocks.Clear();
+  words.Clear();
+  tail.Clear();
+  this->size = 0;
+}
+
+template <typename T>
+int PackedIntVector<T>::Size() const {
+  return this->size;
+}
+
+template <typename T>
+bool PackedIntVector<T>::Empty() const {
+  return size == 0;
+}
+
+template <typename T>
+int PackedIntVector<T>::BlockCount() const {
+  return blocks.Size();
+}
+
+template <typename T>
+int PackedIntVector<T>::BitsPerValue(int block) const {
+  assert(block >= 0);
+  assert(block < blocks.Size());
+  return blocks[block].bits;
+}
+
+template <typename T>
+std::size_t PackedIntVector<T>::MemoryUsage() const {
+  return sizeof(*this) + blocks.Capacity() * sizeof(Block) +
+         words.Capacity() * sizeof(std::uint64_t);
+}
+
+template <typename T>
+void PackedIntVector<T>::DecodeBlock(int block, T* output) const {
+  static constexpr std::array<Unpacker, MaxBits + 1> unpackers =
+      MakeUnpackers(std::make_index_sequence<MaxBits + 1>());
+
+  assert(block >= 0);
+  assert(block < blocks.Size());
+  const Block& header = blocks[block];
+  unpackers[header.bits](words.Data() + header.offset, header.reference,
+                         output);
+}
+
+template <typename T>
+Vector<T> PackedIntVector<T>::ToVector() const {
+  Vector<T> vector(size);
+
+  for (int block = 0; block < blocks.Size(); block++) {
+    this->DecodeBlock(block, vector.Data() + block * BlockSize);
+  }
+
+  for (int i = 0; i < tail.Size(); i++) {
+    vector[blocks.Size() * BlockSize + i] = tail[i];
+  }
+
+  return vector;
+}
+
+template <typename T>
+T PackedIntVector<T>::operator[](int index) const {
+  assert(index >= 0);
+  assert(index < size);
+  int block = index / BlockSize;
+
+  if (block == blocks.Size()) {
+    return tail[index % BlockSize];
+  }
+
+  const Block& header = blocks[block];
+  int position = (index % BlockSize) * header.bits;
+  const std::uint64_t* packed = words.Data() + header.offset;
+  int word = position / WordBits;
+  int shift = position % WordBits;
+
+  if (header.bits == 0) {
+    return header.reference;
+  }
+
+  std::uint64_t value = packed[word] >> shift;
+
+  if (shift + header.bits > WordBits) {
+    value |= packed[word + 1] << (WordBits - shift);
+  }
+
+  return static_cast<T>(static_cast<Unsigned>(header.reference) +
+                        static_cast<Unsigned>(value & Mask(header.bits)));
+}
+
+template <typename T>
+T PackedIntVector<T>::At(int index) const {
+  return (*this)[index];
+}
+
+template <typename T>
+T PackedIntVector<T>::Front() const {
+  return (*this)[0];
+}
+
+template <typename T>
+T PackedIntVector<T>::Back() const {
+  return (*this)[size - 1];
+}
+
+#endif  // _PACKEDINTVECTOR_H_
@@ -0,0 +1,94 @@
+#ifndef _RADIXSORT_H_
+#define _RADIXSORT_H_
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+concept RadixSortable =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// Maps a key to an unsigned integer of the same width whose unsigned order
+// matches the key's order: signed integers get their sign bit flipped, and
+// negative floats have all their bits flipped so that larger magnitudes sort
+// first. NaNs land past the infinities of their sign.
+template <RadixSortable T>
+auto RadixKeyOf(T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+  } else if constexpr (std::is_same_v<T, double>) {
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(value);
+    return (bits & 0x8000000000000000ull) ? ~bits
+                                           : (bits | 0x8000000000000000ull);
+  } else if constexpr (std::is_signed_v<T>) {
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr Unsigned signBit = Unsigned(1) << (sizeof(T) * 8 - 1);
+    return static_cast<Unsigned>(static_cast<Unsigned>(value) ^ signBit);
+  } else {
+    return value;
+  }
+}
+
+// Stable LSD radix sort over 8-bit digits. All digit histograms are built in
+// one pass, and passes where every key shares the same digit are skipped.
+// buffer must have room for size elements; the result always ends up in array.
+template <typename T, typename KeyFunction>
+void RadixSort(T* array, T* buffer, int size, KeyFunction key) {
+  using Key = decltype(RadixKeyOf(key(array[0])));
+  constexpr int digitCount = sizeof(Key);
+
+  if (size <= 1) {
+    return;
+  }
+
+  int histograms[digitCount][256];
+  std::memset(histograms, 0, sizeof(histograms));
+
+  for (int i = 0; i < size; i++) {
+    Key radixKey = RadixKeyOf(key(array[i]));
+
+    for (int digit = 0; digit < digitCount; digit++) {
+      histograms[digit][(radixKey >> (digit * 8)) & 0xff]++;
+    }
+  }
+
+  T* source = array;
+  T* destination = buffer;
+
+  for (int digit = 0; digit < digitCount; digit++) {
+    int* histogram = histograms[digit];
+    int firstKey = (RadixKeyOf(key(source[0])) >> (digit * 8)) & 0xff;
+
+    if (histogram[firstKey] == size) {
+      continue;
+    }
+
+    int offset = 0;
+
+    for (int bucket = 0; bucket < 256; bucket++) {
+      int count = histogram[bucket];
+      histogram[bucket] = offset;
+      offset += count;
+    }
+
+    for (int i = 0; i < size; i++) {
+      int bucket = (RadixKeyOf(key(source[i])) >> (digit * 8)) & 0xff;
+      destination[histogram[bucket]++] = std::move(source[i]);
+    }
+
+    std::swap(source, destination);
+  }
+
+  if (source != array) {
+    for (int i = 0; i < size; i++) {
+      array[i] = std::move(source[i]);
+    }
+  }
+}
+
+#endif  // _RADIXSORT_H_
@@ -0,0 +1,136 @@
+#ifndef _RANDOM_H_
+#define _RANDOM_H_
+
+#include <bit>
+#include <cstdint>
+#include <random>
+
+#include "hash.hpp"
+
+class SplitMix64 {
+ public:
+  using result_type = std::uint64_t;
+
+ private:
+  std::uint64_t state;
+
+ public:
+  explicit SplitMix64(std::uint64_t seed) noexcept : state{seed} {}
+
+  static constexpr result_type min() { return 0; }
+
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  result_type operator()() noexcept {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+};
+
+class Xoshiro256 {
+ public:
+  using result_type = std::uint64_t;
+
+ private:
+  std::uint64_t state[4];
+
+ public:
+  explicit Xoshiro256(std::uint64_t seed) noexcept {
+    SplitMix64 seeder(seed);
+
+    for (std::uint64_t& word : state) {
+      word = seeder();
+    }
+  }
+
+  static constexpr result_type min() { return 0; }
+
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  result_type operator()() noexcept {
+    std::uint64_t result = std::rotl(state[0] + state[3], 23) + state[0];
+    std::uint64_t shifted = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = std::rotl(state[3], 45);
+
+    return result;
+  }
+};
+
+class WyRand {
+ public:
+  using result_type = std::uint64_t;
+
+ private:
+  std::uint64_t state;
+
+ public:
+  explicit WyRand(std::uint64_t seed) noexcept : state{seed} {}
+
+  static constexpr result_type min() { return 0; }
+
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  result_type operator()() noexcept {
+    state += 0xa0761d6478bd642fULL;
+    HashUint128 product =
+        static_cast<HashUint128>(state) * (state ^ 0xe7037ed1a0b428dbULL);
+    return static_cast<std::uint64_t>(product >> 64) ^
+           static_cast<std::uint64_t>(product);
+  }
+};
+
+// A full 64 bit value from any UniformRandomBitGenerator. Generators with a
+// narrower range, such as std::mt19937, are combined over several calls.
+template <typename Generator>
+std::uint64_t Random64(Generator& generator) {
+  if constexpr (Generator::min() == 0 && Generator::max() == UINT64_MAX) {
+    return generator();
+  } else {
+    return std::uniform_int_distribution<std::uint64_t>()(generator);
+  }
+}
+
+// Unbiased value in [0, bound) using Lemire's multiply-and-reject method,
+// which only divides on the rare rejection path.
+template <typename Generator>
+std::uint64_t BoundedRandom(Generator& generator, std::uint64_t bound) {
+  HashUint128 product = static_cast<HashUint128>(Random64(generator)) *
+                        static_cast<HashUint128>(bound);
+  std::uint64_t low = static_cast<std::uint64_t>(product);
+
+  if (low < bound) {
+    std::uint64_t threshold = (0 - bound) % bound;
+
+    while (low < threshold) {
+      product = static_cast<HashUint128>(Random64(generator)) *
+                static_cast<HashUint128>(bound);
+      low = static_cast<std::uint64_t>(product);
+    }
+  }
+
+  return static_cast<std::uint64_t>(product >> 64);
+}
+
+// Uniform double in the open interval (0, 1).
+template <typename Generator>
+double OpenUnitRandom(Generator& generator) {
+  return (static_cast<double>(Random64(generator) >> 11) + 0.5) * 0x1.0p-53;
+}
+
+inline WyRand& DefaultRandomGenerator() {
+  thread_local WyRand generator((static_cast<std::uint64_t>(
+                                     std::random_device()())
+                                 << 32) ^
+                                std::random_device()());
+  return generator;
+}
+
+#endif  // _RANDOM_H_
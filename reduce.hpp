@@ -0,0 +1,330 @@
+#ifndef _REDUCE_H_
+#define _REDUCE_H_
+
+#include <type_traits>
+
+// Reduction kernels over contiguous arithmetic arrays. Each kernel keeps
+// ReduceLanes independent accumulators so the loop carries no dependency from
+// one element to the next; the compiler turns the lanes into vector registers
+// without needing -ffast-math. On x86-64 every kernel is also compiled for
+// AVX2 and picked at runtime when the CPU supports it.
+
+enum class SumMode { Fast, Kahan, Pairwise };
+
+template <typename T>
+using ReduceSumType = std::conditional_t<
+    std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>>;
+
+template <typename T>
+struct ReduceMinMax {
+  T min;
+  T max;
+};
+
+template <typename T>
+struct MinMaxResult {
+  T min;
+  T max;
+  int minIndex;
+  int maxIndex;
+};
+
+constexpr int ReduceLanes = 8;
+constexpr int PairwiseBlock = 128;
+
+#define VECTOR_REDUCE_INLINE inline __attribute__((always_inline))
+
+template <typename T>
+VECTOR_REDUCE_INLINE ReduceSumType<T> ReduceSum(const T* array, int size) {
+  ReduceSumType<T> lanes[ReduceLanes] = {};
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      lanes[j] += array[i + j];
+    }
+  }
+
+  ReduceSumType<T> total = 0;
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    total += lanes[j];
+  }
+
+  for (; i < size; i++) {
+    total += array[i];
+  }
+
+  return total;
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE T ReduceKahanSum(const T* array, int size) {
+  T sums[ReduceLanes] = {};
+  T compensations[ReduceLanes] = {};
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      T adjusted = array[i + j] - compensations[j];
+      T next = sums[j] + adjusted;
+      compensations[j] = (next - sums[j]) - adjusted;
+      sums[j] = next;
+    }
+  }
+
+  T total = 0;
+  T compensation = 0;
+
+  auto add = [&total, &compensation](T value) {
+    T adjusted = value - compensation;
+    T next = total + adjusted;
+    compensation = (next - total) - adjusted;
+    total = next;
+  };
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    add(sums[j]);
+    add(-compensations[j]);
+  }
+
+  for (; i < size; i++) {
+    add(array[i]);
+  }
+
+  return total;
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE T ReducePairwiseSum(const T* array, int size) {
+  // Blocks are summed with the lane kernel and merged like a binary counter,
+  // so every partial sum only meets partial sums covering as many elements
+  // and the rounding error grows with log(size) rather than size.
+  T partials[32];
+  int levels[32];
+  int depth = 0;
+
+  for (int begin = 0; begin < size; begin += PairwiseBlock) {
+    int count = size - begin < PairwiseBlock ? size - begin : PairwiseBlock;
+    T partial = ReduceSum(array + begin, count);
+    int level = 0;
+
+    while (depth > 0 && levels[depth - 1] == level) {
+      partial += partials[--depth];
+      level++;
+    }
+
+    partials[depth] = partial;
+    levels[depth] = level;
+    depth++;
+  }
+
+  T total = 0;
+
+  while (depth > 0) {
+    total += partials[--depth];
+  }
+
+  return total;
+}
+
+// The extremes skip NaNs: a NaN never replaces a number and any number
+// replaces a NaN, so a result is NaN only when every element is.
+template <typename T>
+VECTOR_REDUCE_INLINE bool ReduceBelow(T candidate, T current) {
+  return candidate < current || (current != current && candidate == candidate);
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE bool ReduceAbove(T candidate, T current) {
+  return current < candidate || (current != current && candidate == candidate);
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE ReduceMinMax<T> ReduceMinMaxValues(const T* array,
+                                                        int size) {
+  T lows[ReduceLanes];
+  T highs[ReduceLanes];
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    lows[j] = array[0];
+    highs[j] = array[0];
+  }
+
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      T value = array[i + j];
+      lows[j] = ReduceBelow(value, lows[j]) ? value : lows[j];
+      highs[j] = ReduceAbove(value, highs[j]) ? value : highs[j];
+    }
+  }
+
+  ReduceMinMax<T> result{lows[0], highs[0]};
+
+  for (int j = 1; j < ReduceLanes; j++) {
+    result.min = ReduceBelow(lows[j], result.min) ? lows[j] : result.min;
+    result.max = ReduceAbove(highs[j], result.max) ? highs[j] : result.max;
+  }
+
+  for (; i < size; i++) {
+    result.min = ReduceBelow(array[i], result.min) ? array[i] : result.min;
+    result.max = ReduceAbove(array[i], result.max) ? array[i] : result.max;
+  }
+
+  return result;
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE MinMaxResult<T> ReduceMinMaxIndices(const T* array,
+                                                         int size) {
+  T lows[ReduceLanes];
+  T highs[ReduceLanes];
+  int lowIndices[ReduceLanes] = {};
+  int highIndices[ReduceLanes] = {};
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    lows[j] = array[0];
+    highs[j] = array[0];
+  }
+
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      T value = array[i + j];
+      bool below = ReduceBelow(value, lows[j]);
+      bool above = ReduceAbove(value, highs[j]);
+      lows[j] = below ? value : lows[j];
+      lowIndices[j] = below ? i + j : lowIndices[j];
+      highs[j] = above ? value : highs[j];
+      highIndices[j] = above ? i + j : highIndices[j];
+    }
+  }
+
+  MinMaxResult<T> result{lows[0], highs[0], lowIndices[0], highIndices[0]};
+
+  // The lanes interleave, so among equal extremes the lowest index is the
+  // first occurrence.
+  for (int j = 1; j < ReduceLanes; j++) {
+    if (ReduceBelow(lows[j], result.min) ||
+        (lows[j] == result.min && lowIndices[j] < result.minIndex)) {
+      result.min = lows[j];
+      result.minIndex = lowIndices[j];
+    }
+
+    if (ReduceAbove(highs[j], result.max) ||
+        (highs[j] == result.max && highIndices[j] < result.maxIndex)) {
+      result.max = highs[j];
+      result.maxIndex = highIndices[j];
+    }
+  }
+
+  for (; i < size; i++) {
+    if (ReduceBelow(array[i], result.min)) {
+      result.min = array[i];
+      result.minIndex = i;
+    }
+
+    if (ReduceAbove(array[i], result.max)) {
+      result.max = array[i];
+      result.maxIndex = i;
+    }
+  }
+
+  return result;
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE int ReduceCount(const T* array, int size, T value) {
+  int lanes[ReduceLanes] = {};
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      lanes[j] += array[i + j] == value;
+    }
+  }
+
+  int total = 0;
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    total += lanes[j];
+  }
+
+  for (; i < size; i++) {
+    total += array[i] == value;
+  }
+
+  return total;
+}
+
+template <typename T>
+VECTOR_REDUCE_INLINE double ReduceSquaredDeviations(const T* array, int size,
+                                                    double mean) {
+  double lanes[ReduceLanes] = {};
+  int i = 0;
+
+  for (; i + ReduceLanes <= size; i += ReduceLanes) {
+    for (int j = 0; j < ReduceLanes; j++) {
+      double deviation = static_cast<double>(array[i + j]) - mean;
+      lanes[j] += deviation * deviation;
+    }
+  }
+
+  double total = 0;
+
+  for (int j = 0; j < ReduceLanes; j++) {
+    total += lanes[j];
+  }
+
+  for (; i < size; i++) {
+    double deviation = static_cast<double>(array[i]) - mean;
+    total += deviation * deviation;
+  }
+
+  return total;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+inline bool ReduceHasAvx2() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+#define VECTOR_REDUCE_DISPATCH(Kernel)                                 \
+  template <typename... Args>                                          \
+  __attribute__((target("avx2"))) auto Kernel##Avx2(Args... args) {    \
+    return Kernel(args...);                                            \
+  }                                                                    \
+                                                                       \
+  template <typename... Args>                                          \
+  auto Kernel##Dispatch(Args... args) {                                \
+    return ReduceHasAvx2() ? Kernel##Avx2(args...) : Kernel(args...);  \
+  }
+
+#else
+
+#define VECTOR_REDUCE_DISPATCH(Kernel) \
+  template <typename... Args>           \
+  auto Kernel##Dispatch(Args... args) { \
+    return Kernel(args...);             \
+  }
+
+#endif
+
+VECTOR_REDUCE_DISPATCH(ReduceSum)
+VECTOR_REDUCE_DISPATCH(ReduceKahanSum)
+VECTOR_REDUCE_DISPATCH(ReducePairwiseSum)
+VECTOR_REDUCE_DISPATCH(ReduceMinMaxValues)
+VECTOR_REDUCE_DISPATCH(ReduceMinMaxIndices)
+VECTOR_REDUCE_DISPATCH(ReduceCount)
+VECTOR_REDUCE_DISPATCH(ReduceSquaredDeviations)
+
+#undef VECTOR_REDUCE_DISPATCH
+#undef VECTOR_REDUCE_INLINE
+
+#endif  // _REDUCE_H_
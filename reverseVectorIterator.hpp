@@ -1,58 +1,117 @@
 #ifndef _REVERSEVECTORITERATOR_H_
 #define _REVERSEVECTORITERATOR_H_
 
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
 template <typename Vector>
 class ReverseVectorIterator {
  public:
   using ValueType = typename Vector::ValueType;
-  using PointerType = ValueType*;
-  using ReferenceType = ValueType&;
+  using ElementType = std::conditional_t<std::is_const_v<Vector>,
+                                         const ValueType, ValueType>;
+  using PointerType = ElementType*;
+  using ReferenceType = ElementType&;
+  using DifferenceType = std::ptrdiff_t;
+
+  using iterator_concept = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = ValueType;
+  using difference_type = DifferenceType;
+  using pointer = PointerType;
+  using reference = ReferenceType;
+
+  constexpr ReverseVectorIterator() noexcept : data{nullptr} {}
 
-  explicit ReverseVectorIterator(PointerType ptr) : data{ptr} {}
+  // Points one past the element it dereferences, so rbegin can be built from
+  // the end of the buffer and rend from its start.
+  explicit constexpr ReverseVectorIterator(PointerType ptr) noexcept
+      : data{ptr} {}
 
  private:
   PointerType data;
 
  public:
-  ReverseVectorIterator& operator++() noexcept {
+  constexpr ReverseVectorIterator& operator++() noexcept {
     data--;
     return *this;
   }
 
-  ReverseVectorIterator operator++(int) noexcept {
+  constexpr ReverseVectorIterator operator++(int) noexcept {
     ReverseVectorIterator iterator(*this);
     --data;
     return iterator;
   }
 
-  ReverseVectorIterator& operator--() noexcept {
+  constexpr ReverseVectorIterator& operator--() noexcept {
     ++data;
     return *this;
   }
 
-  ReverseVectorIterator operator--(int) noexcept {
+  constexpr ReverseVectorIterator operator--(int) noexcept {
     ReverseVectorIterator iterator(*this);
     ++data;
     return iterator;
   }
 
-  ReferenceType operator[](int index) { return *(data - index); }
+  constexpr ReverseVectorIterator& operator+=(DifferenceType offset) noexcept {
+    data -= offset;
+    return *this;
+  }
+
+  constexpr ReverseVectorIterator& operator-=(DifferenceType offset) noexcept {
+    data += offset;
+    return *this;
+  }
+
+  constexpr ReverseVectorIterator operator+(
+      DifferenceType offset) const noexcept {
+    return ReverseVectorIterator(data - offset);
+  }
+
+  friend constexpr ReverseVectorIterator operator+(
+      DifferenceType offset, const ReverseVectorIterator& iterator) noexcept {
+    return ReverseVectorIterator(iterator.data - offset);
+  }
+
+  constexpr ReverseVectorIterator operator-(
+      DifferenceType offset) const noexcept {
+    return ReverseVectorIterator(data + offset);
+  }
+
+  constexpr DifferenceType operator-(
+      const ReverseVectorIterator& other) const noexcept {
+    return other.data - data;
+  }
+
+  constexpr ReferenceType operator[](DifferenceType index) const {
+    return *(data - index - 1);
+  }
 
-  PointerType operator->() const { return data; }
+  constexpr PointerType operator->() const { return data - 1; }
 
-  ReferenceType operator*() const { return *data; }
+  constexpr ReferenceType operator*() const { return *(data - 1); }
 
-  bool operator==(const ReverseVectorIterator& other) const {
+  constexpr bool operator==(const ReverseVectorIterator& other) const {
     return data == other.data;
   }
 
-  bool operator!=(const ReverseVectorIterator& other) const {
+  constexpr bool operator!=(const ReverseVectorIterator& other) const {
     return !(data == other.data);
   }
 
-  operator ReverseVectorIterator<const ReverseVectorIterator>() const {
-    return ReverseVectorIterator<const ReverseVectorIterator>(data);
+  constexpr std::strong_ordering operator<=>(
+      const ReverseVectorIterator& other) const {
+    return other.data <=> data;
+  }
+
+  constexpr operator ReverseVectorIterator<const Vector>() const
+    requires(!std::is_const_v<Vector>)
+  {
+    return ReverseVectorIterator<const Vector>(data);
   }
 };
 
-#endif  // _REVERSEVECTORITERATOR_H_
\ No newline at end of file
+#endif  // _REVERSEVECTORITERATOR_H_
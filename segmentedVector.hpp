@@ -0,0 +1,515 @@
+#ifndef _SEGMENTEDVECTOR_H_
+#define _SEGMENTEDVECTOR_H_
+
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+template <typename T, int FirstBlockSize = 16>
+class SegmentedVector {
+  static_assert(FirstBlockSize > 0 && std::has_single_bit(
+                                          static_cast<unsigned>(FirstBlockSize)),
+                "FirstBlockSize must be a power of two.");
+
+ public:
+  using ValueType = T;
+  using PointerType = T*;
+  using ConstPointer = const T*;
+  using ReferenceType = T&;
+  using ConstReferenceType = const T&;
+
+  template <bool Const>
+  class BasicIterator {
+   private:
+    using Owner =
+        std::conditional_t<Const, const SegmentedVector, SegmentedVector>;
+
+    Owner* vector;
+    int index;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    BasicIterator() noexcept : vector{nullptr}, index{0} {}
+
+    BasicIterator(Owner* vector, int index) noexcept
+        : vector{vector}, index{index} {}
+
+    BasicIterator& operator++() noexcept {
+      index++;
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator iterator(*this);
+      index++;
+      return iterator;
+    }
+
+    BasicIterator& operator--() noexcept {
+      index--;
+      return *this;
+    }
+
+    BasicIterator operator--(int) noexcept {
+      BasicIterator iterator(*this);
+      index--;
+      return iterator;
+    }
+
+    BasicIterator& operator+=(difference_type offset) noexcept {
+      index += static_cast<int>(offset);
+      return *this;
+    }
+
+    BasicIterator& operator-=(difference_type offset) noexcept {
+      index -= static_cast<int>(offset);
+      return *this;
+    }
+
+    BasicIterator operator+(difference_type offset) const noexcept {
+      return BasicIterator(vector, index + static_cast<int>(offset));
+    }
+
+    friend BasicIterator operator+(difference_type offset,
+                                   const BasicIterator& iterator) noexcept {
+      return iterator + offset;
+    }
+
+    BasicIterator operator-(difference_type offset) const noexcept {
+      return BasicIterator(vector, index - static_cast<int>(offset));
+    }
+
+    difference_type operator-(const BasicIterator& other) const noexcept {
+      return index - other.index;
+    }
+
+    reference operator[](difference_type offset) const {
+      return (*vector)[index + static_cast<int>(offset)];
+    }
+
+    pointer operator->() const { return &(*vector)[index]; }
+
+    reference operator*() const { return (*vector)[index]; }
+
+    bool operator==(const BasicIterator& other) const {
+      return index == other.index;
+    }
+
+    std::strong_ordering operator<=>(const BasicIterator& other) const {
+      return index <=> other.index;
+    }
+  };
+
+  using Iterator = BasicIterator<false>;
+  using ConstIterator = BasicIterator<true>;
+
+  static constexpr int FirstBlockShift =
+      std::countr_zero(static_cast<unsigned>(FirstBlockSize));
+  static constexpr int MaxBlocks = 31 - FirstBlockShift;
+
+ private:
+  T* blocks[MaxBlocks];
+  int blockCount;
+  int size;
+  int capacity;
+
+ private:
+  void AddBlock();
+
+ public:
+  SegmentedVector() noexcept;
+  SegmentedVector(const std::initializer_list<T>&) noexcept;
+  SegmentedVector(const SegmentedVector&) noexcept;
+  SegmentedVector(SegmentedVector&&) noexcept;
+  ~SegmentedVector() noexcept;
+
+  void PushBack(const T&);
+  void PushBack(T&&);
+  void PopBack();
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+
+  int Size() const;
+  int Capacity() const;
+  bool Empty() const;
+  void Reserve(int sizeToReserve);
+  void Clear();
+  const T& Front() const;
+  const T& Back() const;
+  T& Front();
+  T& Back();
+  T& At(int index);
+  const T& At(int index) const;
+  int IndexOf(const T&) const;
+  T* Find(const T&) const;
+
+  int BlockCount() const;
+  static int BlockOf(int index);
+  static int OffsetOf(int index, int block);
+  static int BlockSize(int block);
+  std::span<T> Block(int block);
+  std::span<const T> Block(int block) const;
+
+  template <typename Function>
+  void ForEachBlock(Function&& function);
+
+  template <typename Function>
+  void ForEachBlock(Function&& function) const;
+
+  Iterator begin() { return Iterator(this, 0); }
+
+  Iterator end() { return Iterator(this, size); }
+
+  ConstIterator begin() const { return ConstIterator(this, 0); }
+
+  ConstIterator end() const { return ConstIterator(this, size); }
+
+  const T& operator[](int index) const;
+  T& operator[](int index);
+
+  SegmentedVector& operator=(const SegmentedVector& otherVector) noexcept;
+  SegmentedVector& operator=(SegmentedVector&& otherVector) noexcept;
+};
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::BlockOf(int index) {
+  unsigned shifted = static_cast<unsigned>(index) + FirstBlockSize;
+  return std::bit_width(shifted) - 1 - FirstBlockShift;
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::OffsetOf(int index, int block) {
+  return index + FirstBlockSize - (FirstBlockSize << block);
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::BlockSize(int block) {
+  return FirstBlockSize << block;
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::AddBlock() {
+  assert(blockCount < MaxBlocks);
+  int blockSize = BlockSize(blockCount);
+  blocks[blockCount] = new T[blockSize];
+  this->blockCount++;
+  this->capacity += blockSize;
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector() noexcept
+    : blocks{}, blockCount{0}, size{0}, capacity{0} {}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(
+    const std::initializer_list<T>& initList) noexcept
+    : SegmentedVector() {
+  this->Reserve(static_cast<int>(initList.size()));
+
+  for (const T& element : initList) {
+    this->PushBack(element);
+  }
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(
+    const SegmentedVector& otherVector) noexcept
+    : SegmentedVector() {
+  this->Reserve(otherVector.size);
+
+  otherVector.ForEachBlock(
+      [this](const T* blockData, int count) {
+        for (int i = 0; i < count; i++) {
+          this->PushBack(blockData[i]);
+        }
+      });
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(
+    SegmentedVector&& otherVector) noexcept
+    : blockCount{otherVector.blockCount},
+      size{otherVector.size},
+      capacity{otherVector.capacity} {
+  for (int i = 0; i < MaxBlocks; i++) {
+    blocks[i] = otherVector.blocks[i];
+    otherVector.blocks[i] = nullptr;
+  }
+
+  otherVector.blockCount = 0;
+  otherVector.size = 0;
+  otherVector.capacity = 0;
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::~SegmentedVector() noexcept {
+  this->Clear();
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>&
+SegmentedVector<T, FirstBlockSize>::operator=(
+    const SegmentedVector& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  SegmentedVector copy(otherVector);
+  *this = std::move(copy);
+  return *this;
+}
+
+template <typename T, int FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>&
+SegmentedVector<T, FirstBlockSize>::operator=(
+    SegmentedVector&& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  this->Clear();
+
+  for (int i = 0; i < MaxBlocks; i++) {
+    blocks[i] = otherVector.blocks[i];
+    otherVector.blocks[i] = nullptr;
+  }
+
+  this->blockCount = otherVector.blockCount;
+  this->size = otherVector.size;
+  this->capacity = otherVector.capacity;
+  otherVector.blockCount = 0;
+  otherVector.size = 0;
+  otherVector.capacity = 0;
+  return *this;
+}
+
+template <typename T, int FirstBlockSize>
+const T& SegmentedVector<T, FirstBlockSize>::operator[](int index) const {
+  assert(index >= 0);
+  assert(index < size);
+  int block = BlockOf(index);
+  return blocks[block][OffsetOf(index, block)];
+}
+
+template <typename T, int FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::operator[](int index) {
+  assert(index >= 0);
+  assert(index < size);
+  int block = BlockOf(index);
+  return blocks[block][OffsetOf(index, block)];
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::PushBack(const T& newData) {
+  if (size == capacity) {
+    this->AddBlock();
+  }
+
+  int block = BlockOf(size);
+  blocks[block][OffsetOf(size, block)] = newData;
+  this->size++;
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::PushBack(T&& newData) {
+  if (size == capacity) {
+    this->AddBlock();
+  }
+
+  int block = BlockOf(size);
+  blocks[block][OffsetOf(size, block)] = std::move(newData);
+  this->size++;
+}
+
+template <typename T, int FirstBlockSize>
+template <typename... Args>
+void SegmentedVector<T, FirstBlockSize>::EmplaceBack(Args&&... args) {
+  if (size == capacity) {
+    this->AddBlock();
+  }
+
+  int block = BlockOf(size);
+  blocks[block][OffsetOf(size, block)] = T(std::forward<Args>(args)...);
+  this->size++;
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::PopBack() {
+  assert(size > 0);
+  this->size--;
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::Size() const {
+  return this->size;
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::Capacity() const {
+  return this->capacity;
+}
+
+template <typename T, int FirstBlockSize>
+bool SegmentedVector<T, FirstBlockSize>::Empty() const {
+  return size == 0;
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::Reserve(int sizeToReserve) {
+  while (capacity < sizeToReserve) {
+    this->AddBlock();
+  }
+}
+
+template <typename T, int FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::Clear() {
+  for (int i = 0; i < blockCount; i++) {
+    delete[] blocks[i];
+    blocks[i] = nullptr;
+  }
+
+  this->blockCount = 0;
+  this->size = 0;
+  this->capacity = 0;
+}
+
+template <typename T, int FirstBlockSize>
+const T& SegmentedVector<T, FirstBlockSize>::Front() const {
+  assert(size > 0);
+  return blocks[0][0];
+}
+
+template <typename T, int FirstBlockSize>
+const T& SegmentedVector<T, FirstBlockSize>::Back() const {
+  assert(size > 0);
+  return (*this)[size - 1];
+}
+
+template <typename T, int FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::Front() {
+  assert(size > 0);
+  return blocks[0][0];
+}
+
+template <typename T, int FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::Back() {
+  assert(size > 0);
+  return (*this)[size - 1];
+}
+
+template <typename T, int FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::At(int index) {
+  return (*this)[index];
+}
+
+template <typename T, int FirstBlockSize>
+const T& SegmentedVector<T, FirstBlockSize>::At(int index) const {
+  return (*this)[index];
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::IndexOf(const T& dataToFind) const {
+  int index = 0;
+
+  for (int block = 0; block < blockCount && index < size; block++) {
+    std::span<const T> elements = this->Block(block);
+
+    for (const T& element : elements) {
+      if (element == dataToFind) {
+        return index;
+      }
+
+      index++;
+    }
+  }
+
+  return -1;
+}
+
+template <typename T, int FirstBlockSize>
+T* SegmentedVector<T, FirstBlockSize>::Find(const T& dataToFind) const {
+  int index = this->IndexOf(dataToFind);
+
+  if (index == -1) {
+    return nullptr;
+  }
+
+  int block = BlockOf(index);
+  return &blocks[block][OffsetOf(index, block)];
+}
+
+template <typename T, int FirstBlockSize>
+int SegmentedVector<T, FirstBlockSize>::BlockCount() const {
+  return this->blockCount;
+}
+
+template <typename T, int FirstBlockSize>
+std::span<T> SegmentedVector<T, FirstBlockSize>::Block(int block) {
+  assert(block >= 0);
+  assert(block < blockCount);
+  int first = BlockSize(block) - FirstBlockSize;
+  int count = size - first;
+
+  if (count > BlockSize(block)) {
+    count = BlockSize(block);
+  }
+
+  return std::span<T>(blocks[block], count > 0 ? count : 0);
+}
+
+template <typename T, int FirstBlockSize>
+std::span<const T> SegmentedVector<T, FirstBlockSize>::Block(int block) const {
+  assert(block >= 0);
+  assert(block < blockCount);
+  int first = BlockSize(block) - FirstBlockSize;
+  int count = size - first;
+
+  if (count > BlockSize(block)) {
+    count = BlockSize(block);
+  }
+
+  return std::span<const T>(blocks[block], count > 0 ? count : 0);
+}
+
+template <typename T, int FirstBlockSize>
+template <typename Function>
+void SegmentedVector<T, FirstBlockSize>::ForEachBlock(Function&& function) {
+  for (int block = 0; block < blockCount; block++) {
+    std::span<T> elements = this->Block(block);
+
+    if (elements.empty()) {
+      return;
+    }
+
+    function(elements.data(), static_cast<int>(elements.size()));
+  }
+}
+
+template <typename T, int FirstBlockSize>
+template <typename Function>
+void SegmentedVector<T, FirstBlockSize>::ForEachBlock(
+    Function&& function) const {
+  for (int block = 0; block < blockCount; block++) {
+    std::span<const T> elements = this->Block(block);
+
+    if (elements.empty()) {
+      return;
+    }
+
+    function(elements.data(), static_cast<int>(elements.size()));
+  }
+}
+
+#endif  // _SEGMENTEDVECTOR_H_
@@ -0,0 +1,245 @@
+#ifndef _SNAPSHOTVECTOR_H_
+#define _SNAPSHOTVECTOR_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "vector.hpp"
+
+// ReaderSlots bounds how many snapshots can be held at once without copying.
+// Once every slot is taken, Read copies the current version under the writer
+// lock instead, so extra readers cost a copy rather than spinning.
+template <typename T, int ReaderSlots = 64>
+class SnapshotVector {
+  static_assert(ReaderSlots > 0, "ReaderSlots must be positive.");
+
+ public:
+  using ValueType = T;
+  using ConstIterator = typename Vector<T>::ConstIterator;
+
+ private:
+  static constexpr int OwnedCopy = -1;
+
+ public:
+  class Snapshot {
+   private:
+    const SnapshotVector* owner;
+    const Vector<T>* vector;
+    int slot;
+
+   public:
+    Snapshot(const SnapshotVector* owner, const Vector<T>* vector, int slot)
+        : owner{owner}, vector{vector}, slot{slot} {}
+
+    Snapshot(const Snapshot&) = delete;
+
+    Snapshot(Snapshot&& other) noexcept
+        : owner{other.owner}, vector{other.vector}, slot{other.slot} {
+      other.owner = nullptr;
+    }
+
+    ~Snapshot() {
+      if (owner == nullptr) {
+        return;
+      }
+
+      if (slot == OwnedCopy) {
+        delete vector;
+      } else {
+        owner->ReleaseSlot(slot);
+      }
+    }
+
+    int Size() const { return vector->Size(); }
+
+    bool Empty() const { return vector->Empty(); }
+
+    const T* Find(const T& dataToFind) const {
+      return vector->Find(dataToFind);
+    }
+
+    int IndexOf(const T& dataToFind) const {
+      return vector->IndexOf(dataToFind);
+    }
+
+    int BinarySeach(const T& target) const {
+      return vector->BinarySeach(target);
+    }
+
+    ConstIterator begin() const { return vector->cbegin(); }
+
+    ConstIterator end() const { return vector->cend(); }
+
+    const Vector<T>& operator*() const { return *vector; }
+
+    const Vector<T>* operator->() const { return vector; }
+
+    const T& operator[](int index) const { return (*vector)[index]; }
+
+    Snapshot& operator=(const Snapshot&) = delete;
+  };
+
+ private:
+  struct Retired {
+    const Vector<T>* vector;
+    std::uint64_t epoch;
+  };
+
+  struct alignas(64) ReaderSlot {
+    std::atomic<std::uint64_t> epoch;
+  };
+
+  std::atomic<const Vector<T>*> current;
+  std::atomic<std::uint64_t> epoch;
+  mutable ReaderSlot readers[ReaderSlots];
+  mutable std::mutex writerMutex;
+  Vector<Retired> retired;
+
+ private:
+  void ReleaseSlot(int slot) const;
+  void PublishLocked(Vector<T>&& next);
+  int ReclaimLocked();
+
+ public:
+  SnapshotVector() noexcept;
+  SnapshotVector(Vector<T>&&) noexcept;
+  SnapshotVector(const SnapshotVector&) = delete;
+  ~SnapshotVector() noexcept;
+
+  Snapshot Read() const;
+  void Publish(Vector<T>&& next);
+
+  template <typename Function>
+  void Update(Function&& mutate);
+
+  int Reclaim();
+  int PendingReclamation();
+
+  SnapshotVector& operator=(const SnapshotVector&) = delete;
+};
+
+template <typename T, int ReaderSlots>
+SnapshotVector<T, ReaderSlots>::SnapshotVector() noexcept
+    : SnapshotVector(Vector<T>()) {}
+
+template <typename T, int ReaderSlots>
+SnapshotVector<T, ReaderSlots>::SnapshotVector(Vector<T>&& initial) noexcept
+    : current{new Vector<T>(std::move(initial))}, epoch{1} {
+  for (ReaderSlot& reader : readers) {
+    reader.epoch.store(0, std::memory_order_relaxed);
+  }
+}
+
+template <typename T, int ReaderSlots>
+SnapshotVector<T, ReaderSlots>::~SnapshotVector() noexcept {
+  for (int i = 0; i < retired.Size(); i++) {
+    delete retired[i].vector;
+  }
+
+  delete current.load();
+}
+
+template <typename T, int ReaderSlots>
+typename SnapshotVector<T, ReaderSlots>::Snapshot
+SnapshotVector<T, ReaderSlots>::Read() const {
+  // A reader announces the epoch it started in before loading the current
+  // version. A version retired in epoch R can only be held by readers that
+  // announced an epoch <= R, because the writer swaps the version before it
+  // advances the epoch.
+  std::uint64_t observed = epoch.load();
+  int slot = static_cast<int>(std::hash<std::thread::id>()(
+                                  std::this_thread::get_id()) %
+                              ReaderSlots);
+
+  for (int probe = 0; probe < ReaderSlots; probe++) {
+    std::uint64_t idle = 0;
+
+    if (readers[slot].epoch.compare_exchange_strong(idle, observed)) {
+      return Snapshot(this, current.load(), slot);
+    }
+
+    slot = (slot + 1) % ReaderSlots;
+  }
+
+  // Every slot is held. The writer lock keeps the current version alive
+  // while it is copied into a snapshot of its own.
+  std::lock_guard<std::mutex> lock(writerMutex);
+  return Snapshot(this, new Vector<T>(*current.load()), OwnedCopy);
+}
+
+template <typename T, int ReaderSlots>
+void SnapshotVector<T, ReaderSlots>::ReleaseSlot(int slot) const {
+  readers[slot].epoch.store(0, std::memory_order_release);
+}
+
+template <typename T, int ReaderSlots>
+void SnapshotVector<T, ReaderSlots>::Publish(Vector<T>&& next) {
+  std::lock_guard<std::mutex> lock(writerMutex);
+  this->PublishLocked(std::move(next));
+}
+
+template <typename T, int ReaderSlots>
+void SnapshotVector<T, ReaderSlots>::PublishLocked(Vector<T>&& next) {
+  const Vector<T>* previous = current.exchange(new Vector<T>(std::move(next)));
+  std::uint64_t retiredAt = epoch.fetch_add(1);
+
+  retired.PushBack(Retired{previous, retiredAt});
+  this->ReclaimLocked();
+}
+
+template <typename T, int ReaderSlots>
+template <typename Function>
+void SnapshotVector<T, ReaderSlots>::Update(Function&& mutate) {
+  std::lock_guard<std::mutex> lock(writerMutex);
+  Vector<T> next(*current.load());
+
+  mutate(next);
+  this->PublishLocked(std::move(next));
+}
+
+template <typename T, int ReaderSlots>
+int SnapshotVector<T, ReaderSlots>::ReclaimLocked() {
+  std::uint64_t oldestReader = UINT64_MAX;
+
+  for (const ReaderSlot& reader : readers) {
+    std::uint64_t announced = reader.epoch.load();
+
+    if (announced != 0 && announced < oldestReader) {
+      oldestReader = announced;
+    }
+  }
+
+  Vector<Retired> stillRead;
+  int reclaimed = 0;
+
+  for (int i = 0; i < retired.Size(); i++) {
+    if (retired[i].epoch < oldestReader) {
+      delete retired[i].vector;
+      reclaimed++;
+    } else {
+      stillRead.PushBack(retired[i]);
+    }
+  }
+
+  retired = std::move(stillRead);
+  return reclaimed;
+}
+
+template <typename T, int ReaderSlots>
+int SnapshotVector<T, ReaderSlots>::Reclaim() {
+  std::lock_guard<std::mutex> lock(writerMutex);
+  return this->ReclaimLocked();
+}
+
+template <typename T, int ReaderSlots>
+int SnapshotVector<T, ReaderSlots>::PendingReclamation() {
+  std::lock_guard<std::mutex> lock(writerMutex);
+  return retired.Size();
+}
+
+#endif  // _SNAPSHOTVECTOR_H_
@@ -0,0 +1,304 @@
+#ifndef _SOAVECTOR_H_
+#define _SOAVECTOR_H_
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "vector.hpp"
+
+template <typename... Fields>
+class SoaVector {
+  static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field.");
+
+ public:
+  template <int Field>
+  using FieldType = std::tuple_element_t<Field, std::tuple<Fields...>>;
+  using RowType = std::tuple<Fields...>;
+
+  class Reference {
+   private:
+    SoaVector* vector;
+    int index;
+
+   public:
+    Reference(SoaVector* vector, int index) : vector{vector}, index{index} {}
+
+    template <int Field>
+    FieldType<Field>& Get() const {
+      return std::get<Field>(vector->columns)[index];
+    }
+
+    int Index() const { return index; }
+
+    operator RowType() const { return vector->Row(index); }
+
+    Reference& operator=(const RowType& row) {
+      vector->SetRow(index, row, std::index_sequence_for<Fields...>{});
+      return *this;
+    }
+  };
+
+  class ConstReference {
+   private:
+    const SoaVector* vector;
+    int index;
+
+   public:
+    ConstReference(const SoaVector* vector, int index)
+        : vector{vector}, index{index} {}
+
+    template <int Field>
+    const FieldType<Field>& Get() const {
+      return std::get<Field>(vector->columns)[index];
+    }
+
+    int Index() const { return index; }
+
+    operator RowType() const { return vector->Row(index); }
+  };
+
+  class Iterator {
+   private:
+    SoaVector* vector;
+    int index;
+
+   public:
+    Iterator(SoaVector* vector, int index) : vector{vector}, index{index} {}
+
+    Iterator& operator++() noexcept {
+      index++;
+      return *this;
+    }
+
+    Reference operator*() const { return Reference(vector, index); }
+
+    bool operator==(const Iterator& other) const {
+      return index == other.index;
+    }
+
+    bool operator!=(const Iterator& other) const {
+      return !(index == other.index);
+    }
+  };
+
+ private:
+  std::tuple<Vector<Fields>...> columns;
+
+ private:
+  template <typename Function>
+  void ForEachColumn(Function&& function);
+
+  template <std::size_t... Indices>
+  RowType RowImpl(int index, std::index_sequence<Indices...>) const;
+
+  template <std::size_t... Indices>
+  void SetRow(int index, const RowType& row, std::index_sequence<Indices...>);
+
+  template <std::size_t... Indices, typename... Args>
+  void EmplaceBackImpl(std::index_sequence<Indices...>, Args&&... args);
+
+ public:
+  SoaVector() noexcept;
+
+  int Size() const;
+  int Capacity() const;
+  bool Empty() const;
+  void Reserve(int sizeToReserve);
+  void ShrinkToFit();
+  void Clear();
+
+  void PushBack(const Fields&... fields);
+  void PushBack(const RowType& row);
+
+  template <typename... Args>
+  void EmplaceBack(Args&&... args);
+
+  void PopBack();
+  void Erase(int index);
+  RowType Row(int index) const;
+
+  template <int Field>
+  void SortBy();
+
+  template <int Field>
+  FieldType<Field>* Data();
+
+  template <int Field>
+  const FieldType<Field>* Data() const;
+
+  // Mutable access to a column is a span, so elements can change but the
+  // columns cannot fall out of step in length.
+  template <int Field>
+  std::span<FieldType<Field>> Column();
+
+  template <int Field>
+  const Vector<FieldType<Field>>& Column() const;
+
+  Iterator begin() { return Iterator(this, 0); }
+
+  Iterator end() { return Iterator(this, this->Size()); }
+
+  Reference operator[](int index);
+  ConstReference operator[](int index) const;
+};
+
+template <typename... Fields>
+SoaVector<Fields...>::SoaVector() noexcept : columns{} {}
+
+template <typename... Fields>
+template <typename Function>
+void SoaVector<Fields...>::ForEachColumn(Function&& function) {
+  std::apply([&function](auto&... column) { (function(column), ...); },
+             columns);
+}
+
+template <typename... Fields>
+template <std::size_t... Indices>
+typename SoaVector<Fields...>::RowType SoaVector<Fields...>::RowImpl(
+    int index, std::index_sequence<Indices...>) const {
+  return RowType(std::get<Indices>(columns)[index]...);
+}
+
+template <typename... Fields>
+template <std::size_t... Indices>
+void SoaVector<Fields...>::SetRow(int index, const RowType& row,
+                                  std::index_sequence<Indices...>) {
+  ((std::get<Indices>(columns)[index] = std::get<Indices>(row)), ...);
+}
+
+template <typename... Fields>
+template <std::size_t... Indices, typename... Args>
+void SoaVector<Fields...>::EmplaceBackImpl(std::index_sequence<Indices...>,
+                                           Args&&... args) {
+  (std::get<Indices>(columns).EmplaceBack(std::forward<Args>(args)), ...);
+}
+
+template <typename... Fields>
+int SoaVector<Fields...>::Size() const {
+  return std::get<0>(columns).Size();
+}
+
+template <typename... Fields>
+int SoaVector<Fields...>::Capacity() const {
+  return std::get<0>(columns).Capacity();
+}
+
+template <typename... Fields>
+bool SoaVector<Fields...>::Empty() const {
+  return this->Size() == 0;
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Reserve(int sizeToReserve) {
+  this->ForEachColumn(
+      [sizeToReserve](auto& column) { column.Reserve(sizeToReserve); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::ShrinkToFit() {
+  this->ForEachColumn([](auto& column) { column.ShrinkToFit(); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Clear() {
+  this->ForEachColumn([](auto& column) { column.Clear(); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::PushBack(const Fields&... fields) {
+  this->EmplaceBackImpl(std::index_sequence_for<Fields...>{}, fields...);
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::PushBack(const RowType& row) {
+  std::apply([this](const Fields&... fields) { this->PushBack(fields...); },
+             row);
+}
+
+template <typename... Fields>
+template <typename... Args>
+void SoaVector<Fields...>::EmplaceBack(Args&&... args) {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "EmplaceBack takes exactly one argument per field.");
+  this->EmplaceBackImpl(std::index_sequence_for<Fields...>{},
+                        std::forward<Args>(args)...);
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::PopBack() {
+  assert(this->Size() > 0);
+  this->ForEachColumn([](auto& column) { column.PopBack(); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Erase(int index) {
+  assert(index >= 0);
+  assert(index < this->Size());
+  this->ForEachColumn([index](auto& column) { column.Erase(index); });
+}
+
+template <typename... Fields>
+typename SoaVector<Fields...>::RowType SoaVector<Fields...>::Row(
+    int index) const {
+  assert(index >= 0);
+  assert(index < this->Size());
+  return this->RowImpl(index, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+template <int Field>
+void SoaVector<Fields...>::SortBy() {
+  Vector<int> order = std::get<Field>(columns).ArgSort();
+
+  this->ForEachColumn(
+      [&order](auto& column) { column.ApplyPermutation(order); });
+}
+
+template <typename... Fields>
+template <int Field>
+typename SoaVector<Fields...>::template FieldType<Field>*
+SoaVector<Fields...>::Data() {
+  return std::get<Field>(columns).Data();
+}
+
+template <typename... Fields>
+template <int Field>
+const typename SoaVector<Fields...>::template FieldType<Field>*
+SoaVector<Fields...>::Data() const {
+  return std::get<Field>(columns).Data();
+}
+
+template <typename... Fields>
+template <int Field>
+std::span<typename SoaVector<Fields...>::template FieldType<Field>>
+SoaVector<Fields...>::Column() {
+  return std::get<Field>(columns).AsSpan();
+}
+
+template <typename... Fields>
+template <int Field>
+const Vector<typename SoaVector<Fields...>::template FieldType<Field>>&
+SoaVector<Fields...>::Column() const {
+  return std::get<Field>(columns);
+}
+
+template <typename... Fields>
+typename SoaVector<Fields...>::Reference SoaVector<Fields...>::operator[](
+    int index) {
+  assert(index >= 0);
+  assert(index < this->Size());
+  return Reference(this, index);
+}
+
+template <typename... Fields>
+typename SoaVector<Fields...>::ConstReference SoaVector<Fields...>::operator[](
+    int index) const {
+  assert(index >= 0);
+  assert(index < this->Size());
+  return ConstReference(this, index);
+}
+
+#endif  // _SOAVECTOR_H_
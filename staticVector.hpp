@@ -0,0 +1,392 @@
+#ifndef _STATICVECTOR_H_
+#define _STATICVECTOR_H_
+
+#include <cassert>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "vectorIterator.hpp"
+
+// A Vector whose elements live inside the object. Capacity is fixed at N and
+// the heap is never touched. When T is trivially copyable so is the
+// StaticVector, so it can be copied with memcpy or placed in shared memory.
+// PushBack, EmplaceBack and Insert require free capacity, which only an
+// assert checks; use TryPushBack or TryEmplaceBack when the vector may be full.
+template <typename T, int N>
+class StaticVector {
+  static_assert(N >= 0, "N must not be negative.");
+
+ public:
+  using ValueType = T;
+  using PointerType = T*;
+  using ConstPointer = const T*;
+  using ReferenceType = T&;
+  using ConstReferenceType = const T&;
+  using Iterator = VectorIterator<StaticVector<T, N>>;
+  using ConstIterator = VectorIterator<const StaticVector<T, N>>;
+
+ private:
+  int size;
+  alignas(T) unsigned char storage[N > 0 ? N * sizeof(T) : 1];
+
+ private:
+  void CopyFrom(const StaticVector& otherVector);
+  void MoveFrom(StaticVector&& otherVector);
+
+ public:
+  StaticVector() noexcept;
+  StaticVector(const std::initializer_list<T>&) noexcept;
+
+  StaticVector(const StaticVector&) noexcept
+    requires std::is_trivially_copyable_v<T>
+  = default;
+  StaticVector(const StaticVector&) noexcept;
+
+  StaticVector(StaticVector&&) noexcept
+    requires std::is_trivially_copyable_v<T>
+  = default;
+  StaticVector(StaticVector&&) noexcept;
+
+  ~StaticVector() noexcept
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  ~StaticVector() noexcept;
+
+  static constexpr int Capacity() { return N; }
+
+  void PushBack(const T&);
+  void PushBack(T&&);
+  [[nodiscard]] bool TryPushBack(const T&);
+  [[nodiscard]] bool TryPushBack(T&&);
+  void PopBack();
+  void Insert(int index, const T& newData);
+  void Erase(int index);
+
+  template <typename... Args>
+  T& EmplaceBack(Args&&... args);
+
+  template <typename... Args>
+  [[nodiscard]] T* TryEmplaceBack(Args&&... args);
+
+  int Size() const;
+  int FreeCapacity() const;
+  bool Empty() const;
+  bool Full() const;
+  void Clear();
+  T& Front();
+  T& Back();
+  const T& Front() const;
+  const T& Back() const;
+  T& At(int index);
+  const T& At(int index) const;
+  T* Data();
+  const T* Data() const;
+  int IndexOf(const T&) const;
+  const T* Find(const T&) const;
+
+  Iterator begin() { return Iterator(this->Data()); }
+
+  Iterator end() { return Iterator(this->Data() + size); }
+
+  ConstIterator begin() const { return ConstIterator(this->Data()); }
+
+  ConstIterator end() const { return ConstIterator(this->Data() + size); }
+
+  T& operator[](int index);
+  const T& operator[](int index) const;
+
+  StaticVector& operator=(const StaticVector&) noexcept
+    requires std::is_trivially_copyable_v<T>
+  = default;
+  StaticVector& operator=(const StaticVector& otherVector) noexcept;
+
+  StaticVector& operator=(StaticVector&&) noexcept
+    requires std::is_trivially_copyable_v<T>
+  = default;
+  StaticVector& operator=(StaticVector&& otherVector) noexcept;
+
+  bool operator==(const StaticVector& otherVector) const;
+};
+
+template <typename T, int N>
+StaticVector<T, N>::StaticVector() noexcept : size{0} {}
+
+template <typename T, int N>
+StaticVector<T, N>::StaticVector(
+    const std::initializer_list<T>& initList) noexcept
+    : size{0} {
+  assert(static_cast<int>(initList.size()) <= N);
+
+  for (const T& element : initList) {
+    this->EmplaceBack(element);
+  }
+}
+
+template <typename T, int N>
+StaticVector<T, N>::StaticVector(const StaticVector& otherVector) noexcept
+    : size{0} {
+  this->CopyFrom(otherVector);
+}
+
+template <typename T, int N>
+StaticVector<T, N>::StaticVector(StaticVector&& otherVector) noexcept
+    : size{0} {
+  this->MoveFrom(std::move(otherVector));
+}
+
+template <typename T, int N>
+StaticVector<T, N>::~StaticVector() noexcept {
+  this->Clear();
+}
+
+template <typename T, int N>
+StaticVector<T, N>& StaticVector<T, N>::operator=(
+    const StaticVector& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  this->Clear();
+  this->CopyFrom(otherVector);
+  return *this;
+}
+
+template <typename T, int N>
+StaticVector<T, N>& StaticVector<T, N>::operator=(
+    StaticVector&& otherVector) noexcept {
+  if (this == &otherVector) {
+    return *this;
+  }
+
+  this->Clear();
+  this->MoveFrom(std::move(otherVector));
+  return *this;
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::CopyFrom(const StaticVector& otherVector) {
+  for (int i = 0; i < otherVector.size; i++) {
+    std::construct_at(this->Data() + i, otherVector[i]);
+  }
+
+  this->size = otherVector.size;
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::MoveFrom(StaticVector&& otherVector) {
+  for (int i = 0; i < otherVector.size; i++) {
+    std::construct_at(this->Data() + i, std::move(otherVector[i]));
+  }
+
+  this->size = otherVector.size;
+  otherVector.Clear();
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::PushBack(const T& newData) {
+  this->EmplaceBack(newData);
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::PushBack(T&& newData) {
+  this->EmplaceBack(std::move(newData));
+}
+
+template <typename T, int N>
+bool StaticVector<T, N>::TryPushBack(const T& newData) {
+  return this->TryEmplaceBack(newData) != nullptr;
+}
+
+template <typename T, int N>
+bool StaticVector<T, N>::TryPushBack(T&& newData) {
+  return this->TryEmplaceBack(std::move(newData)) != nullptr;
+}
+
+template <typename T, int N>
+template <typename... Args>
+T& StaticVector<T, N>::EmplaceBack(Args&&... args) {
+  assert(size < N);
+  T* element =
+      std::construct_at(this->Data() + size, std::forward<Args>(args)...);
+  this->size++;
+  return *element;
+}
+
+template <typename T, int N>
+template <typename... Args>
+T* StaticVector<T, N>::TryEmplaceBack(Args&&... args) {
+  if (size == N) {
+    return nullptr;
+  }
+
+  return &this->EmplaceBack(std::forward<Args>(args)...);
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::PopBack() {
+  assert(size > 0);
+  this->size--;
+  std::destroy_at(this->Data() + size);
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::Insert(int index, const T& newData) {
+  assert(index >= 0);
+  assert(index <= size);
+  assert(size < N);
+
+  if (index == size) {
+    this->EmplaceBack(newData);
+    return;
+  }
+
+  T copy(newData);
+  T* elements = this->Data();
+  std::construct_at(elements + size, std::move(elements[size - 1]));
+
+  for (int i = size - 1; i > index; i--) {
+    elements[i] = std::move(elements[i - 1]);
+  }
+
+  elements[index] = std::move(copy);
+  this->size++;
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::Erase(int index) {
+  assert(index >= 0);
+  assert(index < size);
+  T* elements = this->Data();
+
+  for (int i = index; i < size - 1; i++) {
+    elements[i] = std::move(elements[i + 1]);
+  }
+
+  this->PopBack();
+}
+
+template <typename T, int N>
+int StaticVector<T, N>::Size() const {
+  return this->size;
+}
+
+template <typename T, int N>
+int StaticVector<T, N>::FreeCapacity() const {
+  return N - this->size;
+}
+
+template <typename T, int N>
+bool StaticVector<T, N>::Empty() const {
+  return size == 0;
+}
+
+template <typename T, int N>
+bool StaticVector<T, N>::Full() const {
+  return size == N;
+}
+
+template <typename T, int N>
+void StaticVector<T, N>::Clear() {
+  std::destroy(this->Data(), this->Data() + size);
+  this->size = 0;
+}
+
+template <typename T, int N>
+T& StaticVector<T, N>::operator[](int index) {
+  assert(index >= 0);
+  assert(index < size);
+  return this->Data()[index];
+}
+
+template <typename T, int N>
+const T& StaticVector<T, N>::operator[](int index) const {
+  assert(index >= 0);
+  assert(index < size);
+  return this->Data()[index];
+}
+
+template <typename T, int N>
+T& StaticVector<T, N>::Front() {
+  return (*this)[0];
+}
+
+template <typename T, int N>
+T& StaticVector<T, N>::Back() {
+  return (*this)[size - 1];
+}
+
+template <typename T, int N>
+const T& StaticVector<T, N>::Front() const {
+  return (*this)[0];
+}
+
+template <typename T, int N>
+const T& StaticVector<T, N>::Back() const {
+  return (*this)[size - 1];
+}
+
+template <typename T, int N>
+T& StaticVector<T, N>::At(int index) {
+  return (*this)[index];
+}
+
+template <typename T, int N>
+const T& StaticVector<T, N>::At(int index) const {
+  return (*this)[index];
+}
+
+template <typename T, int N>
+T* StaticVector<T, N>::Data() {
+  // std::launder needs an object at the address, which an empty vector lacks.
+  if (size == 0) {
+    return reinterpret_cast<T*>(storage);
+  }
+
+  return std::launder(reinterpret_cast<T*>(storage));
+}
+
+template <typename T, int N>
+const T* StaticVector<T, N>::Data() const {
+  if (size == 0) {
+    return reinterpret_cast<const T*>(storage);
+  }
+
+  return std::launder(reinterpret_cast<const T*>(storage));
+}
+
+template <typename T, int N>
+int StaticVector<T, N>::IndexOf(const T& dataToFind) const {
+  for (int i = 0; i < size; i++) {
+    if ((*this)[i] == dataToFind) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+template <typename T, int N>
+const T* StaticVector<T, N>::Find(const T& dataToFind) const {
+  int index = this->IndexOf(dataToFind);
+  return index == -1 ? nullptr : this->Data() + index;
+}
+
+template <typename T, int N>
+bool StaticVector<T, N>::operator==(const StaticVector& otherVector) const {
+  if (size != otherVector.size) {
+    return false;
+  }
+
+  for (int i = 0; i < size; i++) {
+    if (!((*this)[i] == otherVector[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#endif  // _STATICVECTOR_H_
@@ -1,18 +1,36 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <algorithm>
+#include <bit>
 #include <cassert>
 #include <cmath>
-#include <ctime>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <ostream>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "hash.hpp"
+#include "radixSort.hpp"
+#include "reduce.hpp"
+#include "random.hpp"
 #include "reverseVectorIterator.hpp"
+#include "vectorBufferCache.hpp"
 #include "vectorIterator.hpp"
+#include "vectorView.hpp"
 
 template <typename T>
 class Vector {
@@ -27,131 +45,322 @@ class Vector {
   using ReverseIterator = ReverseVectorIterator<Vector<T>>;
   using ConstReverseIterator = ReverseVectorIterator<const Vector<T>>;
 
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = int;
+  using difference_type = std::ptrdiff_t;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using reverse_iterator = ReverseIterator;
+  using const_reverse_iterator = ConstReverseIterator;
+  using View = VectorView<std::span<T>>;
+  using ConstView = VectorView<std::span<const T>>;
+
  private:
+  static constexpr int RadixSortThreshold = 256;
+  static constexpr int GallopRatio = 32;
+  static constexpr int MismatchChunk = 16;
+
+  // Types whose equality is exactly equality of their bytes, and types whose
+  // ordering is exactly memcmp's unsigned byte ordering.
+  static constexpr bool BitwiseEquality =
+      std::is_scalar_v<T> && std::has_unique_object_representations_v<T>;
+  static constexpr bool BytewiseOrdering =
+      (std::is_unsigned_v<T> && sizeof(T) == 1) || std::is_same_v<T, std::byte>;
+
+  using Ordering =
+      typename std::conditional_t<std::three_way_comparable<T>,
+                                  std::compare_three_way_result<T>,
+                                  std::type_identity<void>>::type;
+
   int size;
   int capacity;
+
+  // Where the buffer comes from. nullptr means new T[], the default. Like a
+  // std::pmr container, a Vector keeps its resource for its whole lifetime;
+  // only move construction carries it over from the source.
+  std::pmr::memory_resource* resource = nullptr;
   T* data;
 
+  // Clear() halves the capacity once shrinkAfter clears in a row have found
+  // at most 1 / shrinkRatio of it in use. A ratio of 0 never shrinks. Moves
+  // and swaps carry the policy along with the elements.
+  int shrinkRatio = 0;
+  int shrinkAfter = 0;
+  int idleClears = 0;
+
  private:
-  int Partition(T* array, int low, int high);
-  void QuickSort(T* array, int low, int high);
-  int BSearch(T* array, const T& target, int left, int right);
+  constexpr T* Allocate(int count) const;
+  constexpr void Deallocate(T* buffer, int count) const;
+  constexpr bool SameResource(const Vector<T>& otherVector) const;
+  static constexpr void FillRange(T* first, T* last, const T& value);
+  constexpr void ReserveForAppend(int count);
+
+  template <typename InputIterator, typename Sentinel>
+  constexpr void AppendRange(InputIterator first, Sentinel last);
+  constexpr int Partition(T* array, int low, int high);
+  constexpr void QuickSort(T* array, int low, int high);
+  constexpr int BSearch(const T* array, const T& target, int left,
+                        int right) const;
+  static constexpr int Gallop(const T* array, int low, int high,
+                              const T& target);
+  constexpr int Mismatch(const Vector<T>& otherVector, int start) const;
+
+  template <typename Compare>
+  static constexpr void SiftDown(T* heap, int root, int count, Compare compare);
+
+  template <typename Compare>
+  static constexpr void SiftUp(T* heap, int child, Compare compare);
+
+  template <typename Compare>
+  static constexpr void HeapSelect(T* array, int middle, int count,
+                                   Compare compare);
+
+  template <typename Compare>
+  static constexpr void SortHeap(T* heap, int count, Compare compare);
+
+  template <typename Compare>
+  constexpr void InsertionSort(int low, int high, Compare compare);
+
+  template <typename Compare>
+  constexpr void IntroSelect(int low, int high, int k, Compare compare);
 
  public:
-  Vector() noexcept;
-  Vector(int size) noexcept;
-  Vector(int size, const T&) noexcept;
-  Vector(const std::vector<T>&) noexcept;
-  Vector(const std::initializer_list<T>&) noexcept;
-  Vector(const Vector<T>&) noexcept;
-  Vector(Vector&&) noexcept;
-  ~Vector() noexcept;
-
-  void Assign(const std::initializer_list<T>&);
-  void Assign(const std::vector<T>&);
-  void Assign(int count, const T& value);
-  void PushBack(const T&);
-  void PushBack(T&&);
-  void PushFront(const T&);
-  void PushFront(T&&);
-  void PushMiddle(const T&);
-  void PushMiddle(T&&);
-  void Insert(int index, const T& newData);
-  void Insert(int index, T&& newData);
-  void PopFront();
-  void PopBack();
-  void PopMiddle();
-  void Erase(int index);
+  constexpr Vector() noexcept;
+  constexpr Vector(int size) noexcept;
+  constexpr Vector(int size, const T&) noexcept;
+  constexpr Vector(const std::vector<T>&) noexcept;
+  constexpr Vector(std::vector<T>&&) noexcept;
+
+  template <std::size_t Extent>
+  constexpr Vector(std::span<const T, Extent>) noexcept;
+
+  constexpr Vector(const std::initializer_list<T>&) noexcept;
+  constexpr Vector(const Vector<T>&) noexcept;
+  constexpr Vector(Vector&&) noexcept;
+
+  explicit Vector(std::pmr::memory_resource*) noexcept;
+  Vector(int size, const T&, std::pmr::memory_resource*) noexcept;
+  Vector(const std::initializer_list<T>&, std::pmr::memory_resource*) noexcept;
+  Vector(const Vector<T>&, std::pmr::memory_resource*) noexcept;
+
+  template <std::input_iterator InputIterator,
+            std::sentinel_for<InputIterator> Sentinel>
+  constexpr Vector(InputIterator first, Sentinel last);
+
+  template <std::ranges::input_range Range>
+    requires(!std::is_same_v<std::remove_cvref_t<Range>, Vector<T>>)
+  explicit constexpr Vector(Range&& range);
+
+  constexpr ~Vector() noexcept;
+
+  constexpr void Assign(const std::initializer_list<T>&);
+  constexpr void Assign(const std::vector<T>&);
+  constexpr void Assign(int count, const T& value);
+  constexpr void Fill(const T& value);
+  constexpr void Fill(int begin, int end, const T& value);
+  constexpr void PushBack(const T&);
+  constexpr void PushBack(T&&);
+  constexpr void PushFront(const T&);
+  constexpr void PushFront(T&&);
+  constexpr void PushMiddle(const T&);
+  constexpr void PushMiddle(T&&);
+  constexpr void Insert(int index, const T& newData);
+  constexpr void Insert(int index, T&& newData);
+  constexpr void PopFront();
+  constexpr void PopBack();
+  constexpr void PopMiddle();
+  constexpr void Erase(int index);
 
   template <typename... Args>
-  void EmplaceBack(Args&&... args);
+  constexpr void EmplaceBack(Args&&... args);
 
   template <typename... Args>
-  void EmplaceFront(Args&&... args);
+  constexpr void EmplaceFront(Args&&... args);
 
   template <typename... Args>
-  void Emplace(int index, Args&&... args);
-
-  int Size() const;
-  int MaxSize() const;
-  int Capacity() const;
-  int FreeCapacity() const;
-  bool Empty() const;
-  void Reserve(int sizeToReserve);
-  void Resize(int desiredSize);
-  void ShrinkToFit();
-  int GenerateNewCapacity() const;
-  void Clear();
-  const T& Front() const;
-  const T& Back() const;
-  const T& Middle() const;
-  T& Front();
-  T& Back();
-  T& Middle();
-  void Sort();
-  void Reverse();
-  T& At(int index);
-  const T& At(int index) const;
-  void Swap(Vector<T>&);
-  void Swap(T*, T*);
-  int RemoveIf(bool (*function)(const T&));
-  bool RemoveIndexIf(int index, bool (*function)(const T&));
+  constexpr void Emplace(int index, Args&&... args);
+
+  constexpr int Size() const;
+  constexpr int MaxSize() const;
+  constexpr int Capacity() const;
+  constexpr int FreeCapacity() const;
+  constexpr bool Empty() const;
+  constexpr void Reserve(int sizeToReserve);
+  constexpr void Resize(int desiredSize);
+  constexpr void ShrinkToFit();
+  constexpr int GenerateNewCapacity() const;
+  constexpr void Clear();
+  constexpr void Release();
+  constexpr void SetShrinkPolicy(int ratio, int clears);
+  constexpr const T& Front() const;
+  constexpr const T& Back() const;
+  constexpr const T& Middle() const;
+  constexpr T& Front();
+  constexpr T& Back();
+  constexpr T& Middle();
+  constexpr void Sort();
+
+  template <typename KeyFunction>
+  void SortByKey(KeyFunction key);
+
+  template <typename Compare = std::less<T>>
+  Vector<int> ArgSort(Compare compare = Compare()) const;
+
+  constexpr void ApplyPermutation(const Vector<int>& permutation);
+
+  template <typename Compare = std::less<T>>
+  constexpr void NthElement(int k, Compare compare = Compare());
+
+  template <typename Compare = std::less<T>>
+  constexpr void PartialSort(int k, Compare compare = Compare());
+
+  template <typename Compare = std::greater<T>>
+  constexpr Vector<T> TopK(int k, Compare compare = Compare()) const;
+
+  double Median()
+    requires std::is_arithmetic_v<T>;
+
+  double Percentile(double percentile)
+    requires std::is_arithmetic_v<T>;
+
+  constexpr void Reverse();
+  constexpr T& At(int index);
+  constexpr const T& At(int index) const;
+  constexpr void Swap(Vector<T>&);
+  constexpr void Swap(T*, T*);
+  constexpr int RemoveIf(bool (*function)(const T&));
+  constexpr bool RemoveIndexIf(int index, bool (*function)(const T&));
   void Print() const;
-  T* Data();
-  const T* Data() const;
-  void ForEach(T (*function)(const T&, int));
-  bool Every(bool (*function)(const T&, int));
-  bool Any(bool (*function)(const T&, int));
-  int IndexOf(const T&);
-  int LastIndexOf(const T&);
-  T* Find(const T&) const;
-  T* Find(bool (*function)(const T&, int)) const;
-  T* FindLast(const T&) const;
-  T* FindLast(bool (*function)(const T&, int)) const;
+  constexpr T* Data();
+  constexpr std::pmr::memory_resource* Resource() const;
+  constexpr const T* Data() const;
+  constexpr void ForEach(T (*function)(const T&, int));
+  constexpr bool Every(bool (*function)(const T&, int));
+  constexpr bool Any(bool (*function)(const T&, int));
+  constexpr int IndexOf(const T&) const;
+  constexpr int LastIndexOf(const T&) const;
+  constexpr T* Find(const T&) const;
+  constexpr T* Find(bool (*function)(const T&, int)) const;
+  constexpr T* FindLast(const T&) const;
+  constexpr T* FindLast(bool (*function)(const T&, int)) const;
   [[nodiscard]] int GenerateRandomIndex() const;
-  [[nodiscard]] int Midpoint() const;
-  [[nodiscard]] int Midpoint(int newSize) const;
+  [[nodiscard]] constexpr int Midpoint() const;
+  [[nodiscard]] constexpr int Midpoint(int newSize) const;
   void Shuffle();
-  void Concat(const Vector<T>&);
-  void Concat(Vector<T>&&);
-  int BinarySeach(const T&);
 
-  Iterator begin() {
+  template <typename Generator>
+  void Shuffle(Generator& generator);
+
+  template <typename Generator>
+  void ParallelShuffle(Generator& generator, int threadCount = 0);
+
+  Vector<T> Sample(int count) const;
+
+  template <typename Generator>
+  Vector<T> Sample(int count, Generator& generator) const;
+
+  constexpr void Concat(const Vector<T>&);
+  constexpr void Concat(Vector<T>&&);
+  constexpr int BinarySeach(const T&) const;
+  constexpr int Unique();
+  constexpr Vector<T> SetUnion(const Vector<T>&) const;
+  constexpr Vector<T> SetIntersection(const Vector<T>&) const;
+  constexpr Vector<T> SetDifference(const Vector<T>&) const;
+  constexpr bool Includes(const Vector<T>&) const;
+  std::size_t Hash() const;
+
+  ReduceSumType<T> Sum(SumMode mode = SumMode::Fast) const
+    requires std::is_arithmetic_v<T>;
+
+  T Min() const
+    requires std::is_arithmetic_v<T>;
+
+  T Max() const
+    requires std::is_arithmetic_v<T>;
+
+  MinMaxResult<T> MinMax() const
+    requires std::is_arithmetic_v<T>;
+
+  double Mean() const
+    requires std::is_arithmetic_v<T>;
+
+  double Variance() const
+    requires std::is_arithmetic_v<T>;
+
+  int Count(const T& value) const;
+
+  template <typename Predicate>
+  constexpr int CountIf(Predicate predicate) const;
+
+  constexpr std::span<T> AsSpan();
+  constexpr std::span<const T> AsSpan() const;
+  constexpr std::vector<T> ToStdVector() const&;
+  constexpr std::vector<T> ToStdVector() &&;
+  View Slice(int begin, int end);
+  ConstView Slice(int begin, int end) const;
+  View AsView();
+  ConstView AsView() const;
+
+  constexpr Iterator begin() {
     Iterator it(data);
     return it;
   }
 
-  Iterator end() {
+  constexpr Iterator end() {
     Iterator it(data + size);
     return it;
   }
 
-  ConstIterator cbegin() {
+  constexpr ConstIterator begin() const {
+    ConstIterator it(data);
+    return it;
+  }
+
+  constexpr ConstIterator end() const {
+    ConstIterator it(data + size);
+    return it;
+  }
+
+  constexpr ConstIterator cbegin() const {
     ConstIterator it(data);
     return it;
   }
 
-  ConstIterator cend() {
+  constexpr ConstIterator cend() const {
     ConstIterator it(data + size);
     return it;
   }
 
-  ReverseIterator rbegin() {
+  constexpr ReverseIterator rbegin() {
     ReverseIterator it(data + size);
     return it;
   }
 
-  ReverseIterator rend() {
+  constexpr ReverseIterator rend() {
     ReverseIterator it(data);
     return it;
   }
 
-  ConstReverseIterator crbegin() {
+  constexpr ConstReverseIterator rbegin() const {
+    ConstReverseIterator it(data + size);
+    return it;
+  }
+
+  constexpr ConstReverseIterator rend() const {
+    ConstReverseIterator it(data);
+    return it;
+  }
+
+  constexpr ConstReverseIterator crbegin() const {
     ConstReverseIterator it(data + size);
     return it;
   }
 
-  ConstReverseIterator crend() {
+  constexpr ConstReverseIterator crend() const {
     ConstReverseIterator it(data);
     return it;
   }
@@ -159,67 +368,99 @@ class Vector {
   template <typename U>
   friend std::ostream& operator<<(std::ostream& os, const Vector<U>& vector);
 
-  bool operator!=(const Vector<T>&) const;
-  bool operator==(const Vector<T>&) const;
-  bool operator<(const Vector<T>&) const;
-  bool operator<=(const Vector<T>&) const;
-  bool operator>(const Vector<T>&) const;
-  bool operator>=(const Vector<T>&) const;
+  constexpr bool operator!=(const Vector<T>&) const;
+  constexpr bool operator==(const Vector<T>&) const;
+  constexpr bool operator<(const Vector<T>&) const;
+  constexpr bool operator<=(const Vector<T>&) const;
+  constexpr bool operator>(const Vector<T>&) const;
+  constexpr bool operator>=(const Vector<T>&) const;
+
+  constexpr Ordering operator<=>(const Vector<T>&) const
+    requires std::three_way_comparable<T>;
 
-  const T& operator[](int index) const;
-  T& operator[](int index);
+  constexpr const T& operator[](int index) const;
+  constexpr T& operator[](int index);
 
-  Vector<T>& operator=(const Vector<T>& otherVector) noexcept;
-  Vector<T>& operator=(Vector<T>&& otherVector) noexcept;
+  constexpr Vector<T>& operator=(const Vector<T>& otherVector) noexcept;
+  constexpr Vector<T>& operator=(Vector<T>&& otherVector) noexcept;
 };
 
 template <typename T>
-Vector<T>::Vector() noexcept : size{0}, capacity{0}, data{nullptr} {}
+constexpr Vector<T>::Vector() noexcept : size{0}, capacity{0}, data{nullptr} {}
 
 template <typename T>
-Vector<T>::Vector(int size) noexcept
-    : size{size}, capacity{size}, data{new T[capacity]} {}
+constexpr Vector<T>::Vector(int size) noexcept
+    : size{size}, capacity{size}, data{Allocate(capacity)} {}
 
 template <typename T>
-Vector<T>::Vector(int size, const T& fillerData) noexcept
-    : size{size}, capacity{size}, data{new T[capacity]} {
-  for (int i = 0; i < size; i++) {
-    data[i] = fillerData;
-  }
+constexpr Vector<T>::Vector(int size, const T& fillerData) noexcept
+    : size{size}, capacity{size}, data{Allocate(capacity)} {
+  FillRange(data, data + size, fillerData);
 }
 
 template <typename T>
-Vector<T>::Vector(const std::vector<T>& fillerVector) noexcept
-    : size{(int)fillerVector.size()}, capacity{size}, data{new T[capacity]} {
-  for (int i = 0; i < size; i++) {
-    data[i] = std::move(fillerVector[i]);
-  }
+constexpr Vector<T>::Vector(const std::vector<T>& fillerVector) noexcept
+    : size{(int)fillerVector.size()},
+      capacity{size},
+      data{Allocate(capacity)} {
+  std::copy(fillerVector.begin(), fillerVector.end(), data);
 }
 
 template <typename T>
-Vector<T>::Vector(const std::initializer_list<T>& initList) noexcept
-    : size{static_cast<int>(initList.size())},
+constexpr Vector<T>::Vector(std::vector<T>&& fillerVector) noexcept
+    : size{(int)fillerVector.size()},
       capacity{size},
-      data{new T[capacity]} {
-  auto it = initList.begin();
+      data{Allocate(capacity)} {
+  std::move(fillerVector.begin(), fillerVector.end(), data);
+}
 
-  for (int i = 0; i < size; i++) {
-    data[i] = *it;
-    it++;
-  }
+template <typename T>
+template <std::size_t Extent>
+constexpr Vector<T>::Vector(std::span<const T, Extent> span) noexcept
+    : size{static_cast<int>(span.size())},
+      capacity{size},
+      data{Allocate(capacity)} {
+  std::copy(span.begin(), span.end(), data);
+}
+
+template <typename T>
+template <std::input_iterator InputIterator,
+          std::sentinel_for<InputIterator> Sentinel>
+constexpr Vector<T>::Vector(InputIterator first, Sentinel last) : Vector() {
+  this->AppendRange(first, last);
+}
+
+template <typename T>
+template <std::ranges::input_range Range>
+  requires(!std::is_same_v<std::remove_cvref_t<Range>, Vector<T>>)
+constexpr Vector<T>::Vector(Range&& range) : Vector() {
+  this->AppendRange(std::ranges::begin(range), std::ranges::end(range));
+}
+
+template <typename T>
+constexpr Vector<T>::Vector(const std::initializer_list<T>& initList) noexcept
+    : size{static_cast<int>(initList.size())},
+      capacity{size},
+      data{Allocate(capacity)} {
+  std::copy(initList.begin(), initList.end(), data);
 }
 
 template <typename T>
-Vector<T>::Vector(const Vector<T>& otherList) noexcept
-    : size{otherList.Size()}, capacity{size}, data{new T[capacity]} {
+constexpr Vector<T>::Vector(const Vector<T>& otherList) noexcept
+    : size{otherList.Size()}, capacity{size}, data{Allocate(capacity)} {
   for (int i = 0; i < size; i++) {
     data[i] = otherList.data[i];
   }
 }
 
 template <typename T>
-Vector<T>::Vector(Vector<T>&& otherList) noexcept
-    : size{otherList.Size()}, capacity{otherList.Capacity()} {
+constexpr Vector<T>::Vector(Vector<T>&& otherList) noexcept
+    : size{otherList.Size()},
+      capacity{otherList.Capacity()},
+      resource{otherList.resource},
+      shrinkRatio{otherList.shrinkRatio},
+      shrinkAfter{otherList.shrinkAfter},
+      idleClears{otherList.idleClears} {
   this->data = otherList.data;
   otherList.data = nullptr;
   otherList.capacity = 0;
@@ -227,9 +468,40 @@ Vector<T>::Vector(Vector<T>&& otherList) noexcept
 }
 
 template <typename T>
-Vector<T>::~Vector() noexcept {
+Vector<T>::Vector(std::pmr::memory_resource* resource) noexcept
+    : size{0}, capacity{0}, resource{resource}, data{nullptr} {}
+
+template <typename T>
+Vector<T>::Vector(int size, const T& fillerData,
+                  std::pmr::memory_resource* resource) noexcept
+    : size{size}, capacity{size}, resource{resource}, data{Allocate(capacity)} {
+  FillRange(data, data + size, fillerData);
+}
+
+template <typename T>
+Vector<T>::Vector(const std::initializer_list<T>& initList,
+                  std::pmr::memory_resource* resource) noexcept
+    : size{static_cast<int>(initList.size())},
+      capacity{size},
+      resource{resource},
+      data{Allocate(capacity)} {
+  std::copy(initList.begin(), initList.end(), data);
+}
+
+template <typename T>
+Vector<T>::Vector(const Vector<T>& otherList,
+                  std::pmr::memory_resource* resource) noexcept
+    : size{otherList.Size()},
+      capacity{size},
+      resource{resource},
+      data{Allocate(capacity)} {
+  std::copy(otherList.data, otherList.data + size, data);
+}
+
+template <typename T>
+constexpr Vector<T>::~Vector() noexcept {
   if (this->capacity > 0) {
-    delete[] data;
+    Deallocate(data, capacity);
     data = nullptr;
     this->capacity = 0;
     this->size = 0;
@@ -237,27 +509,28 @@ Vector<T>::~Vector() noexcept {
 }
 
 template <typename T>
-const T& Vector<T>::operator[](int index) const {
+constexpr const T& Vector<T>::operator[](int index) const {
   assert(index >= 0);
   assert(index < size);
   return data[index];
 }
 
 template <typename T>
-T& Vector<T>::operator[](int index) {
+constexpr T& Vector<T>::operator[](int index) {
   assert(index >= 0);
   assert(index < size);
   return data[index];
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& otherVector) noexcept {
+constexpr Vector<T>& Vector<T>::operator=(
+    const Vector<T>& otherVector) noexcept {
   if (this == &otherVector) {
-    return;
+    return *this;
   }
 
-  delete[] data;
-  this->data = new T[otherVector.size];
+  Deallocate(data, capacity);
+  this->data = Allocate(otherVector.size);
   this->size = otherVector.size;
   this->capacity = size;
 
@@ -269,12 +542,27 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& otherVector) noexcept {
 }
 
 template <typename T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& otherVector) noexcept {
+constexpr Vector<T>& Vector<T>::operator=(Vector<T>&& otherVector) noexcept {
   if (this == &otherVector) {
-    return;
+    return *this;
+  }
+
+  this->Release();
+  this->shrinkRatio = otherVector.shrinkRatio;
+  this->shrinkAfter = otherVector.shrinkAfter;
+  this->idleClears = otherVector.idleClears;
+
+  if (!this->SameResource(otherVector)) {
+    // The buffer belongs to the other resource, so the elements move into
+    // one of ours instead.
+    this->data = Allocate(otherVector.size);
+    this->size = otherVector.size;
+    this->capacity = size;
+    std::move(otherVector.data, otherVector.data + size, data);
+    otherVector.Release();
+    return *this;
   }
 
-  this->Clear();
   this->data = otherVector.data;
   this->size = otherVector.size;
   this->capacity = otherVector.capacity;
@@ -286,83 +574,147 @@ Vector<T>& Vector<T>::operator=(Vector<T>&& otherVector) noexcept {
 }
 
 template <typename T>
-bool Vector<T>::operator==(const Vector<T>& otherVector) const {
+constexpr int Vector<T>::Mismatch(const Vector<T>& otherVector,
+                                  int start) const {
+  const T* other = otherVector.data;
+  int common = size < otherVector.size ? size : otherVector.size;
+  int i = start;
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Test whole chunks without an early exit so the comparisons vectorize,
+    // and only walk a chunk element by element once it is known to differ.
+    for (; i + MismatchChunk <= common; i += MismatchChunk) {
+      bool differs = false;
+
+      for (int j = i; j < i + MismatchChunk; j++) {
+        differs |= data[j] != other[j];
+      }
+
+      if (differs) {
+        break;
+      }
+    }
+  }
+
+  while (i < common && data[i] == other[i]) {
+    i++;
+  }
+
+  return i;
+}
+
+template <typename T>
+constexpr bool Vector<T>::operator==(const Vector<T>& otherVector) const {
   if (this->size != otherVector.Size()) {
     return false;
   }
 
-  for (int i = 0; i < size; i++) {
-    if (data[i] != otherVector[i]) {
-      return false;
+  if constexpr (BitwiseEquality) {
+    if (!std::is_constant_evaluated()) {
+      assert(size >= 0);
+      return size == 0 ||
+             std::memcmp(data, otherVector.data,
+                         static_cast<std::size_t>(size) * sizeof(T)) == 0;
     }
   }
 
-  return true;
+  return this->Mismatch(otherVector, 0) == size;
 }
 
 template <typename T>
-bool Vector<T>::operator!=(const Vector<T>& otherVector) const {
+constexpr bool Vector<T>::operator!=(const Vector<T>& otherVector) const {
   return !(*this == otherVector);
 }
 
 template <typename T>
-bool Vector<T>::operator<(const Vector<T>& otherVector) const {
-  return this->size < otherVector.Size();
-}
+constexpr typename Vector<T>::Ordering Vector<T>::operator<=>(
+    const Vector<T>& otherVector) const
+  requires std::three_way_comparable<T>
+{
+  int common = size < otherVector.size ? size : otherVector.size;
 
-template <typename T>
-bool Vector<T>::operator<=(const Vector<T>& otherVector) const {
-  if (*this == &otherVector) {
-    return true;
+  if constexpr (BytewiseOrdering) {
+    if (!std::is_constant_evaluated()) {
+      assert(common >= 0);
+      int order = common == 0 ? 0
+                              : std::memcmp(data, otherVector.data,
+                                            static_cast<std::size_t>(common));
+
+      if (order != 0) {
+        return order <=> 0;
+      }
+
+      return size <=> otherVector.size;
+    }
   }
 
-  if (this->size <= otherVector.Size()) {
-    return true;
+  for (int i = this->Mismatch(otherVector, 0); i < common;
+       i = this->Mismatch(otherVector, i + 1)) {
+    auto order = data[i] <=> otherVector.data[i];
+
+    if (order != 0) {
+      return order;
+    }
   }
 
-  return false;
+  return size <=> otherVector.size;
 }
 
 template <typename T>
-bool Vector<T>::operator>(const Vector<T>& otherVector) const {
-  return this->size > otherVector.Size();
+constexpr bool Vector<T>::operator<(const Vector<T>& otherVector) const {
+  if constexpr (std::three_way_comparable<T>) {
+    return (*this <=> otherVector) < 0;
+  } else {
+    return std::lexicographical_compare(data, data + size, otherVector.data,
+                                        otherVector.data + otherVector.size);
+  }
 }
 
 template <typename T>
-bool Vector<T>::operator>=(const Vector<T>& otherVector) const {
-  if (*this == &otherVector) {
-    return true;
+constexpr bool Vector<T>::operator<=(const Vector<T>& otherVector) const {
+  if constexpr (std::three_way_comparable<T>) {
+    return (*this <=> otherVector) <= 0;
+  } else {
+    return !(otherVector < *this);
   }
+}
 
-  if (this->size >= otherVector.Size()) {
-    return true;
-  }
+template <typename T>
+constexpr bool Vector<T>::operator>(const Vector<T>& otherVector) const {
+  return otherVector < *this;
+}
 
-  return false;
+template <typename T>
+constexpr bool Vector<T>::operator>=(const Vector<T>& otherVector) const {
+  if constexpr (std::three_way_comparable<T>) {
+    return (*this <=> otherVector) >= 0;
+  } else {
+    return !(*this < otherVector);
+  }
 }
 
 template <typename T>
-int Vector<T>::Size() const {
+constexpr int Vector<T>::Size() const {
   return this->size;
 }
 
 template <typename T>
-int Vector<T>::MaxSize() const {
+constexpr int Vector<T>::MaxSize() const {
   return this->capacity;
 }
 
 template <typename T>
-int Vector<T>::Capacity() const {
+constexpr int Vector<T>::Capacity() const {
   return this->capacity;
 }
 
 template <typename T>
-int Vector<T>::FreeCapacity() const {
+constexpr int Vector<T>::FreeCapacity() const {
   return this->capacity - this->size;
 }
 
 template <typename T>
-bool Vector<T>::Empty() const {
+constexpr bool Vector<T>::Empty() const {
   if (size == 0) {
     return true;
   }
@@ -371,78 +723,209 @@ bool Vector<T>::Empty() const {
 }
 
 template <typename T>
-T& Vector<T>::Front() {
+constexpr T& Vector<T>::Front() {
   assert(this->size > 0);
   return data[0];
 }
 
 template <typename T>
-T& Vector<T>::Back() {
+constexpr T& Vector<T>::Back() {
   assert(this->size > 0);
   return data[size - 1];
 }
 
 template <typename T>
-T& Vector<T>::Middle() {
+constexpr T& Vector<T>::Middle() {
   assert(this->size > 0);
   int midpoint = this->Midpoint();
   return data[midpoint];
 }
 
 template <typename T>
-const T& Vector<T>::Front() const {
+constexpr const T& Vector<T>::Front() const {
   assert(size > 0);
   return data[0];
 }
 
 template <typename T>
-const T& Vector<T>::Back() const {
+constexpr const T& Vector<T>::Back() const {
   assert(size > 0);
   return data[size - 1];
 }
 
 template <typename T>
-const T& Vector<T>::Middle() const {
+constexpr const T& Vector<T>::Middle() const {
   assert(size > 0);
   int midpoint = this->Midpoint();
   return data[midpoint];
 }
 
 template <typename T>
-T* Vector<T>::Data() {
+constexpr T* Vector<T>::Data() {
   return data;
 }
 
 template <typename T>
-const T* Vector<T>::Data() const {
+constexpr const T* Vector<T>::Data() const {
   return data;
 }
 
 template <typename T>
-void Vector<T>::Assign(const std::initializer_list<T>& initList) {
-  for (const T& element : initList) {
-    PushBack(std::move(element));
+constexpr std::pmr::memory_resource* Vector<T>::Resource() const {
+  return this->resource;
+}
+
+template <typename T>
+constexpr T* Vector<T>::Allocate(int count) const {
+  if (count <= 0) {
+    return nullptr;
+  }
+
+  if (resource != nullptr) {
+    T* buffer = static_cast<T*>(resource->allocate(
+        static_cast<std::size_t>(count) * sizeof(T), alignof(T)));
+    std::uninitialized_default_construct_n(buffer, count);
+    return buffer;
+  }
+
+  if constexpr (VectorBufferCache<T>::Enabled) {
+    if (!std::is_constant_evaluated()) {
+      return VectorBufferCache<T>::Allocate(count);
+    }
+  }
+
+  return new T[count];
+}
+
+template <typename T>
+constexpr void Vector<T>::Deallocate(T* buffer, int count) const {
+  if (resource != nullptr) {
+    if (buffer != nullptr) {
+      std::destroy_n(buffer, count);
+      resource->deallocate(buffer, static_cast<std::size_t>(count) * sizeof(T),
+                           alignof(T));
+    }
+
+    return;
+  }
+
+  if constexpr (VectorBufferCache<T>::Enabled) {
+    if (!std::is_constant_evaluated()) {
+      VectorBufferCache<T>::Deallocate(buffer, count);
+      return;
+    }
   }
+
+  delete[] buffer;
+}
+
+template <typename T>
+constexpr bool Vector<T>::SameResource(const Vector<T>& otherVector) const {
+  return resource == otherVector.resource ||
+         (resource != nullptr && otherVector.resource != nullptr &&
+          resource->is_equal(*otherVector.resource));
 }
 
 template <typename T>
-void Vector<T>::Assign(const std::vector<T>& list) {
-  for (const T& element : list) {
-    PushBack(std::move(element));
+constexpr void Vector<T>::FillRange(T* first, T* last, const T& value) {
+  std::ptrdiff_t distance = last - first;
+
+  if (distance <= 0) {
+    return;
+  }
+
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    // Single bytes and all-zero values (0, 0.0, nullptr) are byte patterns,
+    // so they go through memset; everything else is left to std::fill, which
+    // compiles to broadcast vector stores for arithmetic types.
+    if (!std::is_constant_evaluated()) {
+      std::size_t count = static_cast<std::size_t>(distance);
+
+      if constexpr (sizeof(T) == 1) {
+        unsigned char byte;
+        std::memcpy(&byte, &value, 1);
+        std::memset(first, byte, count);
+        return;
+      } else {
+        unsigned char zero[sizeof(T)] = {};
+
+        if (std::memcmp(&value, zero, sizeof(T)) == 0) {
+          std::memset(static_cast<void*>(first), 0, count * sizeof(T));
+          return;
+        }
+      }
+    }
   }
+
+  std::fill(first, last, value);
 }
 
 template <typename T>
-void Vector<T>::Assign(int count, const T& value) {
-  int counter = 0;
-  while (counter < count) {
-    PushBack(std::move(value));
-    counter++;
+constexpr void Vector<T>::ReserveForAppend(int count) {
+  if (size + count <= capacity) {
+    return;
+  }
+
+  int newCapacity = GenerateNewCapacity();
+  this->Reserve(newCapacity > size + count ? newCapacity : size + count);
+}
+
+template <typename T>
+template <typename InputIterator, typename Sentinel>
+constexpr void Vector<T>::AppendRange(InputIterator first, Sentinel last) {
+  // Ranges that can be measured are copied after a single reservation;
+  // single-pass input has to be appended one element at a time.
+  if constexpr (std::forward_iterator<InputIterator>) {
+    int count = static_cast<int>(std::ranges::distance(first, last));
+    this->ReserveForAppend(count);
+    std::ranges::copy(first, last, data + size);
+    this->size += count;
+  } else {
+    for (; first != last; ++first) {
+      this->PushBack(*first);
+    }
   }
 }
 
 template <typename T>
-void Vector<T>::PushBack(const T& newData) {
+constexpr void Vector<T>::Assign(const std::initializer_list<T>& initList) {
+  int count = static_cast<int>(initList.size());
+  this->ReserveForAppend(count);
+  std::copy(initList.begin(), initList.end(), data + size);
+  this->size += count;
+}
+
+template <typename T>
+constexpr void Vector<T>::Assign(const std::vector<T>& list) {
+  int count = static_cast<int>(list.size());
+  this->ReserveForAppend(count);
+  std::copy(list.begin(), list.end(), data + size);
+  this->size += count;
+}
+
+template <typename T>
+constexpr void Vector<T>::Assign(int count, const T& value) {
+  assert(count >= 0);
+  this->ReserveForAppend(count);
+  FillRange(data + size, data + size + count, value);
+  this->size += count;
+}
+
+template <typename T>
+constexpr void Vector<T>::Fill(const T& value) {
+  FillRange(data, data + size, value);
+}
+
+template <typename T>
+constexpr void Vector<T>::Fill(int begin, int end, const T& value) {
+  assert(begin >= 0);
+  assert(begin <= end);
+  assert(end <= size);
+  FillRange(data + begin, data + end, value);
+}
+
+template <typename T>
+constexpr void Vector<T>::PushBack(const T& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -453,7 +936,7 @@ void Vector<T>::PushBack(const T& newData) {
 }
 
 template <typename T>
-void Vector<T>::PushBack(T&& newData) {
+constexpr void Vector<T>::PushBack(T&& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -464,13 +947,13 @@ void Vector<T>::PushBack(T&& newData) {
 }
 
 template <typename T>
-void Vector<T>::PushFront(const T& newData) {
+constexpr void Vector<T>::PushFront(const T& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
   }
 
-  for (int i = size; i >= 0; i--) {
+  for (int i = size; i > 0; i--) {
     data[i] = std::move(data[i - 1]);
   }
 
@@ -479,13 +962,13 @@ void Vector<T>::PushFront(const T& newData) {
 }
 
 template <typename T>
-void Vector<T>::PushFront(T&& newData) {
+constexpr void Vector<T>::PushFront(T&& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
   }
 
-  for (int i = size; i >= 0; i--) {
+  for (int i = size; i > 0; i--) {
     data[i] = std::move(data[i - 1]);
   }
 
@@ -494,7 +977,7 @@ void Vector<T>::PushFront(T&& newData) {
 }
 
 template <typename T>
-void Vector<T>::Insert(int index, const T& newData) {
+constexpr void Vector<T>::Insert(int index, const T& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -503,8 +986,8 @@ void Vector<T>::Insert(int index, const T& newData) {
   assert(index >= 0);
   assert(index < size);
 
-  for (int i = size; i >= index; i--) {
-    data[i + 1] = data[i];
+  for (int i = size; i > index; i--) {
+    data[i] = std::move(data[i - 1]);
   }
 
   data[index] = newData;
@@ -512,7 +995,7 @@ void Vector<T>::Insert(int index, const T& newData) {
 }
 
 template <typename T>
-void Vector<T>::Insert(int index, T&& newData) {
+constexpr void Vector<T>::Insert(int index, T&& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -521,8 +1004,8 @@ void Vector<T>::Insert(int index, T&& newData) {
   assert(index >= 0);
   assert(index < size);
 
-  for (int i = size; i >= index; i--) {
-    data[i + 1] = data[i];
+  for (int i = size; i > index; i--) {
+    data[i] = std::move(data[i - 1]);
   }
 
   data[index] = std::move(newData);
@@ -530,7 +1013,7 @@ void Vector<T>::Insert(int index, T&& newData) {
 }
 
 template <typename T>
-void Vector<T>::PushMiddle(const T& newData) {
+constexpr void Vector<T>::PushMiddle(const T& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -538,8 +1021,8 @@ void Vector<T>::PushMiddle(const T& newData) {
 
   int midpoint = Midpoint(size + 1);
 
-  for (int i = size; i >= midpoint; i--) {
-    data[i + 1] = data[i];
+  for (int i = size; i > midpoint; i--) {
+    data[i] = std::move(data[i - 1]);
   }
 
   data[midpoint] = newData;
@@ -547,7 +1030,7 @@ void Vector<T>::PushMiddle(const T& newData) {
 }
 
 template <typename T>
-void Vector<T>::PushMiddle(T&& newData) {
+constexpr void Vector<T>::PushMiddle(T&& newData) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -555,8 +1038,8 @@ void Vector<T>::PushMiddle(T&& newData) {
 
   int midpoint = Midpoint(size + 1);
 
-  for (int i = size; i >= midpoint; i--) {
-    data[i + 1] = data[i];
+  for (int i = size; i > midpoint; i--) {
+    data[i] = std::move(data[i - 1]);
   }
 
   data[midpoint] = std::move(newData);
@@ -565,7 +1048,7 @@ void Vector<T>::PushMiddle(T&& newData) {
 
 template <typename T>
 template <typename... Args>
-void Vector<T>::EmplaceBack(Args&&... args) {
+constexpr void Vector<T>::EmplaceBack(Args&&... args) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -577,13 +1060,13 @@ void Vector<T>::EmplaceBack(Args&&... args) {
 
 template <typename T>
 template <typename... Args>
-void Vector<T>::EmplaceFront(Args&&... args) {
+constexpr void Vector<T>::EmplaceFront(Args&&... args) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
   }
 
-  for (int i = size; i >= 0; i--) {
+  for (int i = size; i > 0; i--) {
     data[i] = std::move(data[i - 1]);
   }
 
@@ -593,7 +1076,7 @@ void Vector<T>::EmplaceFront(Args&&... args) {
 
 template <typename T>
 template <typename... Args>
-void Vector<T>::Emplace(int index, Args&&... args) {
+constexpr void Vector<T>::Emplace(int index, Args&&... args) {
   if (size == capacity) {
     int newCapacity = GenerateNewCapacity();
     Resize(newCapacity);
@@ -602,8 +1085,8 @@ void Vector<T>::Emplace(int index, Args&&... args) {
   assert(index >= 0);
   assert(index < size);
 
-  for (int i = size; i >= index; i--) {
-    data[i + 1] = data[i];
+  for (int i = size; i > index; i--) {
+    data[i] = std::move(data[i - 1]);
   }
 
   data[index] = T(std::forward<Args>(args)...);
@@ -611,8 +1094,8 @@ void Vector<T>::Emplace(int index, Args&&... args) {
 }
 
 template <typename T>
-void Vector<T>::PopFront() {
-  for (int i = 0; i < size; i++) {
+constexpr void Vector<T>::PopFront() {
+  for (int i = 0; i < size - 1; i++) {
     data[i] = data[i + 1];
   }
 
@@ -620,15 +1103,15 @@ void Vector<T>::PopFront() {
 }
 
 template <typename T>
-void Vector<T>::PopBack() {
+constexpr void Vector<T>::PopBack() {
   this->size--;
 }
 
 template <typename T>
-void Vector<T>::PopMiddle() {
+constexpr void Vector<T>::PopMiddle() {
   int midpoint = Midpoint();
 
-  for (int i = midpoint; i < size; i++) {
+  for (int i = midpoint; i < size - 1; i++) {
     data[i] = data[i + 1];
   }
 
@@ -636,7 +1119,7 @@ void Vector<T>::PopMiddle() {
 }
 
 template <typename T>
-void Vector<T>::Erase(int index) {
+constexpr void Vector<T>::Erase(int index) {
   assert(index >= 0);
   assert(index < size);
 
@@ -650,7 +1133,7 @@ void Vector<T>::Erase(int index) {
     return;
   }
 
-  for (int i = index; i < size; i++) {
+  for (int i = index; i < size - 1; i++) {
     data[i] = data[i + 1];
   }
 
@@ -658,45 +1141,45 @@ void Vector<T>::Erase(int index) {
 }
 
 template <typename T>
-T& Vector<T>::At(int index) {
+constexpr T& Vector<T>::At(int index) {
   assert(index >= 0);
   assert(index < size);
   return data[index];
 }
 
 template <typename T>
-const T& Vector<T>::At(int index) const {
+constexpr const T& Vector<T>::At(int index) const {
   assert(index >= 0);
   assert(index < size);
   return data[index];
 }
 
 template <typename T>
-void Vector<T>::Resize(int desiredCapacity) {
+constexpr void Vector<T>::Resize(int desiredCapacity) {
   if (desiredCapacity == capacity) {
     return;
   }
 
   if (desiredCapacity > capacity) {
-    T* newData = new T[desiredCapacity];
+    T* newData = Allocate(desiredCapacity);
 
     for (int i = 0; i < size; i++) {
       newData[i] = std::move(data[i]);
     }
 
-    delete[] data;
+    Deallocate(data, capacity);
     data = newData;
     this->capacity = desiredCapacity;
   }
 
   if (desiredCapacity < capacity) {
-    T* newData = new T[desiredCapacity];
+    T* newData = Allocate(desiredCapacity);
 
     for (int i = 0; i < desiredCapacity; i++) {
       newData[i] = std::move(data[i]);
     }
 
-    delete[] data;
+    Deallocate(data, capacity);
     data = newData;
     this->size = desiredCapacity;
     this->capacity = desiredCapacity;
@@ -704,19 +1187,57 @@ void Vector<T>::Resize(int desiredCapacity) {
 }
 
 template <typename T>
-void Vector<T>::Clear() {
-  if (this->capacity == 0) {
+constexpr void Vector<T>::Clear() {
+  // Slots stay constructed for the lifetime of the buffer, so clearing
+  // assigns a fresh T to release whatever the old elements held.
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (int i = 0; i < size; i++) {
+      data[i] = T();
+    }
+  }
+
+  int used = size;
+  this->size = 0;
+
+  if (shrinkRatio == 0) {
+    return;
+  }
+
+  if (static_cast<long long>(used) * shrinkRatio > capacity) {
+    this->idleClears = 0;
+    return;
+  }
+
+  if (++this->idleClears < shrinkAfter) {
     return;
   }
 
+  this->idleClears = 0;
+  Deallocate(data, capacity);
+  this->capacity /= 2;
+  this->data = Allocate(capacity);
+}
+
+template <typename T>
+constexpr void Vector<T>::Release() {
+  Deallocate(data, capacity);
+  this->data = nullptr;
   this->size = 0;
-  this->Resize(0);
-  delete[] data;
-  data = nullptr;
+  this->capacity = 0;
+  this->idleClears = 0;
+}
+
+template <typename T>
+constexpr void Vector<T>::SetShrinkPolicy(int ratio, int clears) {
+  assert(ratio == 0 || ratio >= 2);
+  assert(clears >= 1 || ratio == 0);
+  this->shrinkRatio = ratio;
+  this->shrinkAfter = clears;
+  this->idleClears = 0;
 }
 
 template <typename T>
-void Vector<T>::ShrinkToFit() {
+constexpr void Vector<T>::ShrinkToFit() {
   if (size == capacity) {
     return;
   }
@@ -725,7 +1246,7 @@ void Vector<T>::ShrinkToFit() {
 }
 
 template <typename T>
-void Vector<T>::Reserve(int amountToReserve) {
+constexpr void Vector<T>::Reserve(int amountToReserve) {
   if (amountToReserve <= capacity) {
     return;
   }
@@ -734,7 +1255,7 @@ void Vector<T>::Reserve(int amountToReserve) {
 }
 
 template <typename T>
-int Vector<T>::GenerateNewCapacity() const {
+constexpr int Vector<T>::GenerateNewCapacity() const {
   int currentCapacity = this->capacity;
   int newCapacity;
 
@@ -750,123 +1271,582 @@ int Vector<T>::GenerateNewCapacity() const {
 
 template <typename T>
 [[nodiscard]] int Vector<T>::GenerateRandomIndex() const {
-  srand((unsigned int)(time(nullptr)));
-  int currentLengthOfIndices = size - 1;
-  int randomIndex = rand() % currentLengthOfIndices;
-  return randomIndex;
+  assert(size > 0);
+  return static_cast<int>(BoundedRandom(DefaultRandomGenerator(), size));
 }
 
 template <typename T>
-void Vector<T>::Sort() {
+constexpr void Vector<T>::Sort() {
+  if constexpr (RadixSortable<T>) {
+    if (size >= RadixSortThreshold && !std::is_constant_evaluated()) {
+      T* buffer = Allocate(size);
+      RadixSort(data, buffer, size, [](const T& value) { return value; });
+      Deallocate(buffer, size);
+      return;
+    }
+  }
+
   this->QuickSort(data, 0, size - 1);
 }
 
 template <typename T>
-void Vector<T>::Reverse() {
-  for (int i = 0; i < size / 2; i++) {
-    Swap(&data[i], &data[size - i - 1]);
-  }
+template <typename KeyFunction>
+void Vector<T>::SortByKey(KeyFunction key) {
+  T* buffer = Allocate(size);
+  RadixSort(data, buffer, size, key);
+  Deallocate(buffer, size);
 }
 
 template <typename T>
-void Vector<T>::QuickSort(T* array, int low, int high) {
-  if (low < high) {
-    int partition = this->Partition(array, low, high);
-    QuickSort(array, low, partition - 1);
-    QuickSort(array, partition + 1, high);
+template <typename Compare>
+Vector<int> Vector<T>::ArgSort(Compare compare) const {
+  Vector<int> order(size);
+
+  for (int i = 0; i < size; i++) {
+    order[i] = i;
+  }
+
+  if constexpr (RadixSortable<T> && std::is_same_v<Compare, std::less<T>>) {
+    if (size >= RadixSortThreshold) {
+      order.SortByKey([this](int index) { return data[index]; });
+      return order;
+    }
   }
+
+  std::stable_sort(order.begin(), order.end(), [this, &compare](int a, int b) {
+    return compare(data[a], data[b]);
+  });
+
+  return order;
 }
 
 template <typename T>
-int Vector<T>::Partition(T* array, int low, int high) {
-  int i = low - 1;
-  int j = low;
-  T k = array[high];
+constexpr void Vector<T>::ApplyPermutation(const Vector<int>& permutation) {
+  assert(permutation.Size() == size);
 
-  while (j < high) {
-    if (array[j] <= k) {
-      i++;
+  // Element i moves to the position of every j with permutation[j] == i, so
+  // walking each cycle once needs a single temporary instead of a full copy.
+  Vector<bool> placed(size, false);
 
-      if (i != j) {
-        Swap(&array[i], &array[j]);
-      }
+  for (int start = 0; start < size; start++) {
+    if (placed[start]) {
+      continue;
     }
 
-    j++;
-  }
+    T temporary = std::move(data[start]);
+    int current = start;
 
-  T temp = array[i + 1];
-  array[i + 1] = array[high];
-  array[high] = temp;
-  return i + 1;
-}
+    while (true) {
+      int next = permutation[current];
+      assert(next >= 0 && next < size);
+      placed[current] = true;
 
-template <typename T>
-int Vector<T>::Midpoint() const {
-  int currentLength = size - 1;
-  int midpoint = (int)floor(currentLength / 2);
-  return midpoint;
+      if (next == start) {
+        data[current] = std::move(temporary);
+        break;
+      }
+
+      data[current] = std::move(data[next]);
+      current = next;
+    }
+  }
 }
 
 template <typename T>
-int Vector<T>::Midpoint(int newSize) const {
-  int currentLength = newSize - 1;
-  int midpoint = (int)floor(currentLength / 2);
-  return midpoint;
+template <typename Compare>
+constexpr void Vector<T>::SiftDown(T* heap, int root, int count,
+                                   Compare compare) {
+  while (true) {
+    int largest = root;
+    int left = 2 * root + 1;
+    int right = left + 1;
+
+    if (left < count && compare(heap[largest], heap[left])) {
+      largest = left;
+    }
+
+    if (right < count && compare(heap[largest], heap[right])) {
+      largest = right;
+    }
+
+    if (largest == root) {
+      return;
+    }
+
+    T temporary = std::move(heap[root]);
+    heap[root] = std::move(heap[largest]);
+    heap[largest] = std::move(temporary);
+    root = largest;
+  }
 }
 
 template <typename T>
-void Vector<T>::Shuffle() {
-  int currentIndex = size;
+template <typename Compare>
+constexpr void Vector<T>::SiftUp(T* heap, int child, Compare compare) {
+  while (child > 0) {
+    int parent = (child - 1) / 2;
+
+    if (!compare(heap[parent], heap[child])) {
+      return;
+    }
 
-  while (0 != currentIndex) {
-    int randomIndex = GenerateRandomIndex();
-    currentIndex--;
-    Swap(&data[randomIndex], &data[currentIndex]);
+    T temporary = std::move(heap[parent]);
+    heap[parent] = std::move(heap[child]);
+    heap[child] = std::move(temporary);
+    child = parent;
   }
 }
 
 template <typename T>
-void Vector<T>::Swap(Vector<T>& otherList) {
-  if (this == &otherList) {
-    return;
+template <typename Compare>
+constexpr void Vector<T>::HeapSelect(T* array, int middle, int count,
+                                     Compare compare) {
+  for (int i = middle / 2 - 1; i >= 0; i--) {
+    SiftDown(array, i, middle, compare);
+  }
+
+  for (int i = middle; i < count; i++) {
+    if (compare(array[i], array[0])) {
+      T temporary = std::move(array[i]);
+      array[i] = std::move(array[0]);
+      array[0] = std::move(temporary);
+      SiftDown(array, 0, middle, compare);
+    }
+  }
+}
+
+template <typename T>
+template <typename Compare>
+constexpr void Vector<T>::SortHeap(T* heap, int count, Compare compare) {
+  for (int last = count - 1; last > 0; last--) {
+    T temporary = std::move(heap[last]);
+    heap[last] = std::move(heap[0]);
+    heap[0] = std::move(temporary);
+    SiftDown(heap, 0, last, compare);
   }
+}
 
-  if (otherList.Size() > this->capacity) {
-    int initialSize = this->size;
-    this->Resize(otherList.Size());
-    this->size = otherList.Size();
+template <typename T>
+template <typename Compare>
+constexpr void Vector<T>::InsertionSort(int low, int high, Compare compare) {
+  for (int i = low + 1; i <= high; i++) {
+    T current = std::move(data[i]);
+    int j = i - 1;
 
-    for (int i = 0; i < otherList.Size(); i++) {
-      Swap(&data[i], &otherList.data[i]);
+    while (j >= low && compare(current, data[j])) {
+      data[j + 1] = std::move(data[j]);
+      j--;
     }
 
-    otherList.Resize(initialSize);
-    otherList.size = initialSize;
+    data[j + 1] = std::move(current);
   }
+}
 
-  if (this->capacity > otherList.Size()) {
-    int initialSize = otherList.Size();
-    otherList.Resize(this->size);
-    otherList.size = this->size;
+template <typename T>
+template <typename Compare>
+constexpr void Vector<T>::IntroSelect(int low, int high, int k,
+                                      Compare compare) {
+  int depthLimit = 2 * std::bit_width(static_cast<unsigned>(high - low + 1));
 
-    for (int i = 0; i < size; i++) {
-      Swap(&data[i], &otherList.data[i]);
+  while (high - low > 16) {
+    if (depthLimit-- == 0) {
+      // Quickselect is degrading, so fall back to a guaranteed
+      // O(n log n) heap select; its root is the k-th element.
+      HeapSelect(data + low, k - low + 1, high - low + 1, compare);
+      Swap(&data[low], &data[k]);
+      return;
+    }
+
+    int middle = low + (high - low) / 2;
+
+    if (compare(data[middle], data[low])) {
+      Swap(&data[middle], &data[low]);
+    }
+
+    if (compare(data[high], data[low])) {
+      Swap(&data[high], &data[low]);
+    }
+
+    if (compare(data[high], data[middle])) {
+      Swap(&data[high], &data[middle]);
     }
 
-    this->Resize(initialSize);
-    this->size = initialSize;
+    T pivot = data[middle];
+    int i = low;
+    int j = high;
+
+    while (i <= j) {
+      while (compare(data[i], pivot)) {
+        i++;
+      }
+
+      while (compare(pivot, data[j])) {
+        j--;
+      }
+
+      if (i <= j) {
+        Swap(&data[i], &data[j]);
+        i++;
+        j--;
+      }
+    }
+
+    if (k <= j) {
+      high = j;
+    } else if (k >= i) {
+      low = i;
+    } else {
+      return;
+    }
   }
 
-  if (this->size == otherList.Size()) {
-    for (int i = 0; i < size; i++) {
-      Swap(&data[i], &otherList[i]);
+  this->InsertionSort(low, high, compare);
+}
+
+template <typename T>
+template <typename Compare>
+constexpr void Vector<T>::NthElement(int k, Compare compare) {
+  assert(k >= 0);
+  assert(k < size);
+  this->IntroSelect(0, size - 1, k, compare);
+}
+
+template <typename T>
+template <typename Compare>
+constexpr void Vector<T>::PartialSort(int k, Compare compare) {
+  assert(k >= 0);
+
+  if (k > size) {
+    k = size;
+  }
+
+  HeapSelect(data, k, size, compare);
+  SortHeap(data, k, compare);
+}
+
+template <typename T>
+template <typename Compare>
+constexpr Vector<T> Vector<T>::TopK(int k, Compare compare) const {
+  assert(k >= 0);
+
+  if (k > size) {
+    k = size;
+  }
+
+  // Bounded heap whose root is the worst of the k best elements seen so far.
+  Vector<T> heap;
+  heap.Reserve(k);
+
+  for (int i = 0; i < size && k > 0; i++) {
+    if (heap.Size() < k) {
+      heap.PushBack(data[i]);
+      SiftUp(heap.Data(), heap.Size() - 1, compare);
+    } else if (compare(data[i], heap[0])) {
+      heap[0] = data[i];
+      SiftDown(heap.Data(), 0, k, compare);
+    }
+  }
+
+  SortHeap(heap.Data(), heap.Size(), compare);
+  return heap;
+}
+
+template <typename T>
+double Vector<T>::Median()
+  requires std::is_arithmetic_v<T>
+{
+  return this->Percentile(50.0);
+}
+
+template <typename T>
+double Vector<T>::Percentile(double percentile)
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  assert(percentile >= 0.0 && percentile <= 100.0);
+
+  double position = percentile / 100.0 * (size - 1);
+  int lower = static_cast<int>(position);
+  double fraction = position - lower;
+
+  this->NthElement(lower);
+  double lowerValue = static_cast<double>(data[lower]);
+
+  if (fraction == 0.0 || lower + 1 >= size) {
+    return lowerValue;
+  }
+
+  T upperValue = data[lower + 1];
+
+  for (int i = lower + 2; i < size; i++) {
+    if (data[i] < upperValue) {
+      upperValue = data[i];
+    }
+  }
+
+  return lowerValue + fraction * (static_cast<double>(upperValue) - lowerValue);
+}
+
+template <typename T>
+constexpr void Vector<T>::Reverse() {
+  for (int i = 0; i < size / 2; i++) {
+    Swap(&data[i], &data[size - i - 1]);
+  }
+}
+
+template <typename T>
+constexpr void Vector<T>::QuickSort(T* array, int low, int high) {
+  if (low < high) {
+    int partition = this->Partition(array, low, high);
+    QuickSort(array, low, partition - 1);
+    QuickSort(array, partition + 1, high);
+  }
+}
+
+template <typename T>
+constexpr int Vector<T>::Partition(T* array, int low, int high) {
+  int i = low - 1;
+  int j = low;
+  T k = array[high];
+
+  while (j < high) {
+    if (array[j] <= k) {
+      i++;
+
+      if (i != j) {
+        Swap(&array[i], &array[j]);
+      }
     }
+
+    j++;
   }
+
+  T temp = array[i + 1];
+  array[i + 1] = array[high];
+  array[high] = temp;
+  return i + 1;
+}
+
+template <typename T>
+constexpr int Vector<T>::Midpoint() const {
+  int currentLength = size - 1;
+  int midpoint = currentLength / 2;
+  return midpoint;
+}
+
+template <typename T>
+constexpr int Vector<T>::Midpoint(int newSize) const {
+  int currentLength = newSize - 1;
+  int midpoint = currentLength / 2;
+  return midpoint;
+}
+
+template <typename T>
+void Vector<T>::Shuffle() {
+  this->Shuffle(DefaultRandomGenerator());
 }
 
 template <typename T>
-int Vector<T>::RemoveIf(bool (*function)(const T&)) {
+template <typename Generator>
+void Vector<T>::Shuffle(Generator& generator) {
+  for (int i = size - 1; i > 0; i--) {
+    int randomIndex = static_cast<int>(BoundedRandom(generator, i + 1));
+    Swap(&data[i], &data[randomIndex]);
+  }
+}
+
+template <typename T>
+template <typename Generator>
+void Vector<T>::ParallelShuffle(Generator& generator, int threadCount) {
+  if (threadCount <= 0) {
+    threadCount = static_cast<int>(std::thread::hardware_concurrency());
+  }
+
+  if (threadCount > 256) {
+    threadCount = 256;
+  }
+
+  if (threadCount <= 1 || size < 65536) {
+    this->Shuffle(generator);
+    return;
+  }
+
+  // Every element is sent to a uniformly random bucket, then each bucket is
+  // Fisher-Yates shuffled on its own; the concatenation is a uniform
+  // permutation. Thread t scatters chunk t and then owns bucket t.
+  int bucketCount = threadCount;
+  Vector<unsigned char> buckets(size);
+  Vector<int> counts(threadCount * bucketCount, 0);
+  Vector<int> offsets(threadCount * bucketCount, 0);
+  Vector<int> bucketStarts(bucketCount + 1, 0);
+  Vector<std::uint64_t> seeds(2 * threadCount);
+  Vector<T> scattered(size);
+  Vector<std::thread> threads;
+
+  for (int t = 0; t < 2 * threadCount; t++) {
+    seeds[t] = Random64(generator);
+  }
+
+  auto chunkBegin = [this, threadCount](int t) {
+    return static_cast<int>(static_cast<long long>(size) * t / threadCount);
+  };
+
+  for (int t = 0; t < threadCount; t++) {
+    threads.EmplaceBack([&, t]() {
+      int* localCounts = counts.Data() + t * bucketCount;
+      WyRand localGenerator(seeds[t]);
+
+      for (int i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+        int bucket =
+            static_cast<int>(BoundedRandom(localGenerator, bucketCount));
+        buckets[i] = static_cast<unsigned char>(bucket);
+        localCounts[bucket]++;
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  int running = 0;
+
+  for (int bucket = 0; bucket < bucketCount; bucket++) {
+    bucketStarts[bucket] = running;
+
+    for (int t = 0; t < threadCount; t++) {
+      offsets[t * bucketCount + bucket] = running;
+      running += counts[t * bucketCount + bucket];
+    }
+  }
+
+  bucketStarts[bucketCount] = running;
+  threads.Clear();
+
+  for (int t = 0; t < threadCount; t++) {
+    threads.EmplaceBack([&, t]() {
+      int* localOffsets = offsets.Data() + t * bucketCount;
+
+      for (int i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+        scattered[localOffsets[buckets[i]]++] = std::move(data[i]);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  threads.Clear();
+
+  for (int t = 0; t < threadCount; t++) {
+    threads.EmplaceBack([&, t]() {
+      int first = bucketStarts[t];
+      int last = bucketStarts[t + 1];
+      WyRand localGenerator(seeds[threadCount + t]);
+
+      for (int i = last - 1; i > first; i--) {
+        int randomIndex =
+            first +
+            static_cast<int>(BoundedRandom(localGenerator, i - first + 1));
+        Swap(&scattered[i], &scattered[randomIndex]);
+      }
+
+      for (int i = first; i < last; i++) {
+        data[i] = std::move(scattered[i]);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename T>
+Vector<T> Vector<T>::Sample(int count) const {
+  return this->Sample(count, DefaultRandomGenerator());
+}
+
+template <typename T>
+template <typename Generator>
+Vector<T> Vector<T>::Sample(int count, Generator& generator) const {
+  assert(count >= 0);
+
+  if (count > size) {
+    count = size;
+  }
+
+  Vector<T> reservoir;
+  reservoir.Reserve(count);
+
+  for (int i = 0; i < count; i++) {
+    reservoir.PushBack(data[i]);
+  }
+
+  if (count == 0) {
+    return reservoir;
+  }
+
+  // Algorithm L: jump straight to the next element that enters the
+  // reservoir instead of drawing a random number per element.
+  double weight = std::exp(std::log(OpenUnitRandom(generator)) / count);
+  int index = count - 1;
+
+  while (true) {
+    double skip = std::floor(std::log(OpenUnitRandom(generator)) /
+                             std::log1p(-weight));
+
+    if (skip >= size - index - 1) {
+      break;
+    }
+
+    index += static_cast<int>(skip) + 1;
+    reservoir[static_cast<int>(BoundedRandom(generator, count))] = data[index];
+    weight *= std::exp(std::log(OpenUnitRandom(generator)) / count);
+  }
+
+  return reservoir;
+}
+
+template <typename T>
+constexpr void Vector<T>::Swap(Vector<T>& otherList) {
+  if (this == &otherList) {
+    return;
+  }
+
+  std::swap(shrinkRatio, otherList.shrinkRatio);
+  std::swap(shrinkAfter, otherList.shrinkAfter);
+  std::swap(idleClears, otherList.idleClears);
+
+  if (this->SameResource(otherList)) {
+    std::swap(size, otherList.size);
+    std::swap(capacity, otherList.capacity);
+    std::swap(data, otherList.data);
+    return;
+  }
+
+  // Each buffer has to go back to the resource it came from, so the
+  // elements change places instead and both Vectors keep their resource.
+  Vector<T>& shorter = size < otherList.size ? *this : otherList;
+  Vector<T>& longer = size < otherList.size ? otherList : *this;
+  int common = shorter.size;
+  shorter.Reserve(longer.size);
+
+  for (int i = common; i < longer.size; i++) {
+    shorter.data[i] = std::move(longer.data[i]);
+  }
+
+  for (int i = 0; i < common; i++) {
+    Swap(&data[i], &otherList.data[i]);
+  }
+
+  shorter.size = longer.size;
+  longer.size = common;
+}
+
+template <typename T>
+constexpr int Vector<T>::RemoveIf(bool (*function)(const T&)) {
   int amountRemoved = 0;
 
   for (int i = 0; i < size; i++) {
@@ -882,7 +1862,7 @@ int Vector<T>::RemoveIf(bool (*function)(const T&)) {
 }
 
 template <typename T>
-bool Vector<T>::RemoveIndexIf(int index, bool (*function)(const T&)) {
+constexpr bool Vector<T>::RemoveIndexIf(int index, bool (*function)(const T&)) {
   bool shouldRemove = function(index);
 
   if (shouldRemove) {
@@ -894,7 +1874,7 @@ bool Vector<T>::RemoveIndexIf(int index, bool (*function)(const T&)) {
 }
 
 template <typename T>
-void Vector<T>::ForEach(T (*function)(const T&, int)) {
+constexpr void Vector<T>::ForEach(T (*function)(const T&, int)) {
   int index = 0;
   for (int i = 0; i < size; i++) {
     data[i] = std::move(function(data[i], index));
@@ -903,7 +1883,7 @@ void Vector<T>::ForEach(T (*function)(const T&, int)) {
 }
 
 template <typename T>
-bool Vector<T>::Every(bool (*function)(const T&, int)) {
+constexpr bool Vector<T>::Every(bool (*function)(const T&, int)) {
   int index = 0;
   for (int i = 0; i < size; i++) {
     bool every = function(data[i], index);
@@ -919,7 +1899,7 @@ bool Vector<T>::Every(bool (*function)(const T&, int)) {
 }
 
 template <typename T>
-bool Vector<T>::Any(bool (*function)(const T&, int)) {
+constexpr bool Vector<T>::Any(bool (*function)(const T&, int)) {
   int index = 0;
   for (int i = 0; i < size; i++) {
     bool some = function(data[i], index);
@@ -934,7 +1914,7 @@ bool Vector<T>::Any(bool (*function)(const T&, int)) {
 }
 
 template <typename T>
-int Vector<T>::IndexOf(const T& dataToFind) {
+constexpr int Vector<T>::IndexOf(const T& dataToFind) const {
   int counter = 0;
   int index = -1;
 
@@ -951,7 +1931,7 @@ int Vector<T>::IndexOf(const T& dataToFind) {
 }
 
 template <typename T>
-int Vector<T>::LastIndexOf(const T& dataToFind) {
+constexpr int Vector<T>::LastIndexOf(const T& dataToFind) const {
   int counter = size - 1;
   int index = -1;
 
@@ -968,7 +1948,7 @@ int Vector<T>::LastIndexOf(const T& dataToFind) {
 }
 
 template <typename T>
-T* Vector<T>::Find(const T& dataToFind) const {
+constexpr T* Vector<T>::Find(const T& dataToFind) const {
   for (int i = 0; i < size; i++) {
     if (data[i] == dataToFind) {
       return &data[i];
@@ -979,7 +1959,7 @@ T* Vector<T>::Find(const T& dataToFind) const {
 }
 
 template <typename T>
-T* Vector<T>::Find(bool (*function)(const T&, int)) const {
+constexpr T* Vector<T>::Find(bool (*function)(const T&, int)) const {
   for (int i = 0; i < size; i++) {
     if (function(data[i], i)) {
       return &data[i];
@@ -990,7 +1970,7 @@ T* Vector<T>::Find(bool (*function)(const T&, int)) const {
 }
 
 template <typename T>
-T* Vector<T>::FindLast(const T& dataToFind) const {
+constexpr T* Vector<T>::FindLast(const T& dataToFind) const {
   for (int i = size - 1; i >= 0; i--) {
     if (data[i] == dataToFind) {
       return &data[i];
@@ -1001,7 +1981,7 @@ T* Vector<T>::FindLast(const T& dataToFind) const {
 }
 
 template <typename T>
-T* Vector<T>::FindLast(bool (*function)(const T&, int)) const {
+constexpr T* Vector<T>::FindLast(bool (*function)(const T&, int)) const {
   for (int i = size - 1; i >= 0; i--) {
     if (function(data[i], i)) {
       return &data[i];
@@ -1012,14 +1992,14 @@ T* Vector<T>::FindLast(bool (*function)(const T&, int)) const {
 }
 
 template <typename T>
-void Vector<T>::Swap(T* a, T* b) {
+constexpr void Vector<T>::Swap(T* a, T* b) {
   T temporary = std::move(*a);
   *a = std::move(*b);
   *b = std::move(temporary);
 }
 
 template <typename T>
-void Vector<T>::Concat(const Vector<T>& otherVector) {
+constexpr void Vector<T>::Concat(const Vector<T>& otherVector) {
   if (otherVector.Size() == 0) {
     return;
   }
@@ -1037,15 +2017,16 @@ void Vector<T>::Concat(const Vector<T>& otherVector) {
 }
 
 template <typename T>
-int Vector<T>::BinarySeach(const T& target) {
+constexpr int Vector<T>::BinarySeach(const T& target) const {
   return this->BSearch(data, target, 0, size - 1);
 }
 
 template <typename T>
-int Vector<T>::BSearch(T* array, const T& target, int left, int right) {
+constexpr int Vector<T>::BSearch(const T* array, const T& target, int left,
+                       int right) const {
   while (left <= right) {
-    int middle = static_cast<int>(floor((left + right) / 2));
-    int middleValue = array[middle];
+    int middle = left + (right - left) / 2;
+    const T& middleValue = array[middle];
 
     if (target == middleValue) {
       return middle;
@@ -1059,6 +2040,418 @@ int Vector<T>::BSearch(T* array, const T& target, int left, int right) {
   return -1;
 }
 
+template <typename T>
+constexpr int Vector<T>::Gallop(const T* array, int low, int high,
+                                const T& target) {
+  // Returns the first index in [low, high) whose value is not less than
+  // target, probing 1, 2, 4, ... ahead before binary searching the last step,
+  // so a match near low costs O(log distance) rather than O(log high - low).
+  int step = 1;
+  int bound = low;
+
+  while (bound < high && array[bound] < target) {
+    low = bound + 1;
+    bound += step;
+    step *= 2;
+  }
+
+  if (bound > high) {
+    bound = high;
+  }
+
+  while (low < bound) {
+    int middle = low + (bound - low) / 2;
+
+    if (array[middle] < target) {
+      low = middle + 1;
+    } else {
+      bound = middle;
+    }
+  }
+
+  return low;
+}
+
+template <typename T>
+constexpr int Vector<T>::Unique() {
+  if (size <= 1) {
+    return 0;
+  }
+
+  int write = 1;
+
+  for (int read = 1; read < size; read++) {
+    if (!(data[read] == data[write - 1])) {
+      if (read != write) {
+        data[write] = std::move(data[read]);
+      }
+
+      write++;
+    }
+  }
+
+  int removed = size - write;
+  this->size = write;
+  return removed;
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::SetUnion(const Vector<T>& otherVector) const {
+  const T* other = otherVector.data;
+  int otherSize = otherVector.size;
+  Vector<T> result;
+  result.Reserve(size + otherSize);
+
+  T* output = result.data;
+  int i = 0;
+  int j = 0;
+  int k = 0;
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    // Each side advances unless it is strictly greater, so at least one of
+    // them moves every step even when a NaN compares false both ways.
+    while (i < size && j < otherSize) {
+      T left = data[i];
+      T right = other[j];
+      bool less = left < right;
+      bool greater = right < left;
+      output[k++] = greater ? right : left;
+      i += !greater;
+      j += !less;
+    }
+  } else {
+    while (i < size && j < otherSize) {
+      if (other[j] < data[i]) {
+        output[k++] = other[j++];
+      } else {
+        if (!(data[i] < other[j])) {
+          j++;
+        }
+
+        output[k++] = data[i++];
+      }
+    }
+  }
+
+  while (i < size) {
+    output[k++] = data[i++];
+  }
+
+  while (j < otherSize) {
+    output[k++] = other[j++];
+  }
+
+  result.size = k;
+  return result;
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::SetIntersection(
+    const Vector<T>& otherVector) const {
+  // Matching elements are always copied from this Vector, as
+  // std::set_intersection copies from its first range.
+  const T* other = otherVector.data;
+  int otherSize = otherVector.size;
+  Vector<T> result;
+  result.Reserve(size < otherSize ? size : otherSize);
+
+  T* output = result.data;
+  int i = 0;
+  int j = 0;
+  int k = 0;
+
+  if (static_cast<long long>(size) * GallopRatio < otherSize) {
+    for (; i < size && j < otherSize; i++) {
+      j = Gallop(other, j, otherSize, data[i]);
+
+      if (j < otherSize && !(data[i] < other[j])) {
+        output[k++] = data[i];
+        j++;
+      }
+    }
+  } else if (static_cast<long long>(otherSize) * GallopRatio < size) {
+    for (; j < otherSize && i < size; j++) {
+      i = Gallop(data, i, size, other[j]);
+
+      if (i < size && !(other[j] < data[i])) {
+        output[k++] = data[i];
+        i++;
+      }
+    }
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    while (i < size && j < otherSize) {
+      T left = data[i];
+      T right = other[j];
+      bool less = left < right;
+      bool greater = right < left;
+      output[k] = left;
+      k += !less && !greater;
+      i += !greater;
+      j += !less;
+    }
+  } else {
+    while (i < size && j < otherSize) {
+      if (data[i] < other[j]) {
+        i++;
+      } else if (other[j] < data[i]) {
+        j++;
+      } else {
+        output[k++] = data[i++];
+        j++;
+      }
+    }
+  }
+
+  result.size = k;
+  return result;
+}
+
+template <typename T>
+constexpr Vector<T> Vector<T>::SetDifference(
+    const Vector<T>& otherVector) const {
+  const T* other = otherVector.data;
+  int otherSize = otherVector.size;
+  Vector<T> result;
+  result.Reserve(size);
+
+  T* output = result.data;
+  int i = 0;
+  int j = 0;
+  int k = 0;
+
+  if (static_cast<long long>(size) * GallopRatio < otherSize) {
+    for (; i < size && j < otherSize; i++) {
+      j = Gallop(other, j, otherSize, data[i]);
+
+      if (j < otherSize && !(data[i] < other[j])) {
+        j++;
+      } else {
+        output[k++] = data[i];
+      }
+    }
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    while (i < size && j < otherSize) {
+      T left = data[i];
+      T right = other[j];
+      bool less = left < right;
+      bool greater = right < left;
+      output[k] = left;
+      k += less;
+      i += !greater;
+      j += !less;
+    }
+  } else {
+    while (i < size && j < otherSize) {
+      if (data[i] < other[j]) {
+        output[k++] = data[i++];
+      } else if (other[j] < data[i]) {
+        j++;
+      } else {
+        i++;
+        j++;
+      }
+    }
+  }
+
+  while (i < size) {
+    output[k++] = data[i++];
+  }
+
+  result.size = k;
+  return result;
+}
+
+template <typename T>
+constexpr bool Vector<T>::Includes(const Vector<T>& otherVector) const {
+  const T* other = otherVector.data;
+  int otherSize = otherVector.size;
+
+  if (otherSize > size) {
+    return false;
+  }
+
+  int i = 0;
+
+  if (static_cast<long long>(otherSize) * GallopRatio < size) {
+    for (int j = 0; j < otherSize; j++) {
+      i = Gallop(data, i, size, other[j]);
+
+      if (i == size || other[j] < data[i]) {
+        return false;
+      }
+
+      i++;
+    }
+
+    return true;
+  }
+
+  for (int j = 0; j < otherSize; j++) {
+    while (i < size && data[i] < other[j]) {
+      i++;
+    }
+
+    if (i == size || other[j] < data[i]) {
+      return false;
+    }
+
+    i++;
+  }
+
+  return true;
+}
+
+template <typename T>
+std::size_t Vector<T>::Hash() const {
+  if constexpr (std::has_unique_object_representations_v<T>) {
+    return HashBytes(data, static_cast<std::size_t>(size) * sizeof(T));
+  } else {
+    std::uint64_t hash =
+        HashMix(static_cast<std::uint64_t>(size), HashSecret[2]);
+
+    for (int i = 0; i < size; i++) {
+      hash = HashCombine(hash, std::hash<T>()(data[i]));
+    }
+
+    return hash;
+  }
+}
+
+template <typename T>
+ReduceSumType<T> Vector<T>::Sum(SumMode mode) const
+  requires std::is_arithmetic_v<T>
+{
+  if constexpr (std::is_floating_point_v<T>) {
+    if (mode == SumMode::Kahan) {
+      return ReduceKahanSumDispatch(static_cast<const T*>(data), size);
+    }
+
+    if (mode == SumMode::Pairwise) {
+      return ReducePairwiseSumDispatch(static_cast<const T*>(data), size);
+    }
+  }
+
+  return ReduceSumDispatch(static_cast<const T*>(data), size);
+}
+
+template <typename T>
+T Vector<T>::Min() const
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  return ReduceMinMaxValuesDispatch(static_cast<const T*>(data), size).min;
+}
+
+template <typename T>
+T Vector<T>::Max() const
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  return ReduceMinMaxValuesDispatch(static_cast<const T*>(data), size).max;
+}
+
+template <typename T>
+MinMaxResult<T> Vector<T>::MinMax() const
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  return ReduceMinMaxIndicesDispatch(static_cast<const T*>(data), size);
+}
+
+template <typename T>
+double Vector<T>::Mean() const
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  return static_cast<double>(this->Sum(SumMode::Pairwise)) / size;
+}
+
+template <typename T>
+double Vector<T>::Variance() const
+  requires std::is_arithmetic_v<T>
+{
+  assert(size > 0);
+  return ReduceSquaredDeviationsDispatch(static_cast<const T*>(data), size,
+                                         this->Mean()) /
+         size;
+}
+
+template <typename T>
+int Vector<T>::Count(const T& value) const {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return ReduceCountDispatch(static_cast<const T*>(data), size, value);
+  } else {
+    int count = 0;
+
+    for (int i = 0; i < size; i++) {
+      count += data[i] == value;
+    }
+
+    return count;
+  }
+}
+
+template <typename T>
+template <typename Predicate>
+constexpr int Vector<T>::CountIf(Predicate predicate) const {
+  int count = 0;
+
+  for (int i = 0; i < size; i++) {
+    count += static_cast<bool>(predicate(data[i]));
+  }
+
+  return count;
+}
+
+template <typename T>
+constexpr std::span<T> Vector<T>::AsSpan() {
+  return std::span<T>(data, size);
+}
+
+template <typename T>
+constexpr std::span<const T> Vector<T>::AsSpan() const {
+  return std::span<const T>(data, size);
+}
+
+template <typename T>
+constexpr std::vector<T> Vector<T>::ToStdVector() const& {
+  return std::vector<T>(data, data + size);
+}
+
+template <typename T>
+constexpr std::vector<T> Vector<T>::ToStdVector() && {
+  std::vector<T> result(std::make_move_iterator(data),
+                        std::make_move_iterator(data + size));
+  this->Release();
+  return result;
+}
+
+template <typename T>
+typename Vector<T>::View Vector<T>::Slice(int begin, int end) {
+  assert(begin >= 0);
+  assert(begin <= end);
+  assert(end <= size);
+  return View(std::span<T>(data + begin, end - begin));
+}
+
+template <typename T>
+typename Vector<T>::ConstView Vector<T>::Slice(int begin, int end) const {
+  assert(begin >= 0);
+  assert(begin <= end);
+  assert(end <= size);
+  return ConstView(std::span<const T>(data + begin, end - begin));
+}
+
+template <typename T>
+typename Vector<T>::View Vector<T>::AsView() {
+  return View(this->AsSpan());
+}
+
+template <typename T>
+typename Vector<T>::ConstView Vector<T>::AsView() const {
+  return ConstView(this->AsSpan());
+}
+
 template <typename T>
 void Vector<T>::Print() const {
   if (this->size == 0) {
@@ -1083,4 +2476,11 @@ std::ostream& operator<<(std::ostream& os, const Vector<T>& vector) {
   return os;
 }
 
+template <typename T>
+struct std::hash<Vector<T>> {
+  std::size_t operator()(const Vector<T>& vector) const {
+    return vector.Hash();
+  }
+};
+
 #endif
\ No newline at end of file
@@ -2,9 +2,34 @@
 
 #include "vector.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "Vector3.hpp"
+#include "bitVector.hpp"
+#include "concurrentVector.hpp"
+#include "cowVector.hpp"
+#include "incrementalVector.hpp"
+#include "packedIntVector.hpp"
+#include "segmentedVector.hpp"
+#include "snapshotVector.hpp"
+#include "soaVector.hpp"
+#include "staticVector.hpp"
 #include "vendor/catch.hpp"
 
 TEST_CASE("Assigns Elements to the Vector.", "[Assign]") {
@@ -44,6 +69,149 @@ TEST_CASE("Assigns Elements to the Vector.", "[Assign]") {
   }
 }
 
+TEST_CASE("Fills the Vector in bulk.", "[Fill]") {
+  SECTION("Appends many elements with a single allocation.") {
+    Vector<double> vector{1.5};
+
+    vector.Assign(1000, 0.0);
+    vector.Assign({2.0, 3.0});
+    vector.Assign(std::vector<double>{4.0});
+
+    REQUIRE(vector.Size() == 1004);
+    REQUIRE(vector[0] == 1.5);
+    REQUIRE(vector[1] == 0.0);
+    REQUIRE(vector[1000] == 0.0);
+    REQUIRE(vector[1001] == 2.0);
+    REQUIRE(vector[1003] == 4.0);
+  }
+
+  SECTION("Overwrites every element, or a range of them.") {
+    Vector<std::uint8_t> bytes(100, 7);
+    Vector<int> numbers(100, -1);
+    Vector<std::string> words(3, "old");
+
+    bytes.Fill(0xab);
+    numbers.Fill(10, 20, 0);
+    numbers.Fill(20, 30, 5);
+    words.Fill("new");
+
+    bool filled = true;
+
+    for (int i = 0; i < 100; i++) {
+      int expected = i < 10 ? -1 : i < 20 ? 0 : i < 30 ? 5 : -1;
+      filled = filled && bytes[i] == 0xab && numbers[i] == expected;
+    }
+
+    REQUIRE(filled);
+    REQUIRE(words[2] == "new");
+  }
+}
+
+TEST_CASE("Converts between the Vector and standard containers.",
+          "[Interop]") {
+  SECTION("Constructs from iterator pairs, spans and ranges.") {
+    std::vector<int> source{1, 2, 3, 4, 5};
+    std::list<int> linked{6, 7};
+    std::istringstream stream("8 9 10");
+
+    Vector<int> fromIterators(source.begin() + 1, source.end());
+    Vector<int> fromSpan(std::span<const int>(source).first(2));
+    Vector<int> fromList(linked);
+    Vector<int> fromView(std::views::iota(0, 4));
+    Vector<int> fromStream{std::istream_iterator<int>(stream),
+                           std::istream_iterator<int>()};
+
+    REQUIRE(fromIterators == Vector<int>{2, 3, 4, 5});
+    REQUIRE(fromIterators.Capacity() == 4);
+    REQUIRE(fromSpan == Vector<int>{1, 2});
+    REQUIRE(fromList == Vector<int>{6, 7});
+    REQUIRE(fromView == Vector<int>{0, 1, 2, 3});
+    REQUIRE(fromStream == Vector<int>{8, 9, 10});
+  }
+
+  SECTION("Views the Vector as a span without copying.") {
+    Vector<int> vector{1, 2, 3};
+    std::span<const int> view = vector.AsSpan();
+    std::span<int> mutableView = vector.AsSpan();
+
+    mutableView[0] = 10;
+
+    REQUIRE(view.data() == vector.Data());
+    REQUIRE(view.size() == 3);
+    REQUIRE(vector[0] == 10);
+  }
+
+  SECTION("Moves the elements out into a std::vector.") {
+    Vector<std::string> words{"alpha", "beta"};
+    std::vector<std::string> copied = words.ToStdVector();
+    std::vector<std::string> moved = std::move(words).ToStdVector();
+
+    REQUIRE(copied == moved);
+    REQUIRE(moved[1] == "beta");
+    REQUIRE(words.Empty());
+
+    std::vector<std::string> source{"gamma"};
+    Vector<std::string> adopted(std::move(source));
+
+    REQUIRE(adopted[0] == "gamma");
+  }
+}
+
+constexpr unsigned SortedTableChecksum() {
+  Vector<int> table;
+
+  for (int i = 0; i < 300; i++) {
+    table.PushBack((i * 7919) % 301);
+  }
+
+  table.Sort();
+
+  Vector<int> copy(table);
+  unsigned checksum = 0;
+
+  for (int value : copy) {
+    checksum = checksum * 31 + value;
+  }
+
+  return copy == table && *copy.Find(150) == 150 ? checksum : 0;
+}
+
+constexpr int BinarySearchAtCompileTime(int target) {
+  Vector<int> primes{2, 3, 5, 7, 11, 13, 17, 19};
+  return primes.BinarySeach(target);
+}
+
+TEST_CASE("Builds and sorts Vectors in constant expressions.", "[Constexpr]") {
+  constexpr unsigned checksum = SortedTableChecksum();
+  static_assert(BinarySearchAtCompileTime(13) == 5);
+  static_assert(BinarySearchAtCompileTime(4) == -1);
+  static_assert([] {
+    Vector<int> values{2, 4};
+    values.PushFront(1);
+    values.Insert(2, 3);
+    values.PushMiddle(0);
+    values.EmplaceFront(-1);
+    values.Emplace(1, -2);
+    return values == Vector<int>{-1, -2, 1, 2, 0, 3, 4};
+  }());
+
+  Vector<int> table;
+
+  for (int i = 0; i < 300; i++) {
+    table.PushBack((i * 7919) % 301);
+  }
+
+  table.Sort();
+
+  unsigned runtimeChecksum = 0;
+
+  for (int value : table) {
+    runtimeChecksum = runtimeChecksum * 31 + value;
+  }
+
+  REQUIRE(checksum == runtimeChecksum);
+}
+
 TEST_CASE("Returns the current size of the vector.", "[Size]") {
   SECTION(
       "Returns 0 when the list, is initialized using the Default "
@@ -761,19 +929,292 @@ TEST_CASE("Reserves memory for the Vector.", "[Reserve]") {
 }
 
 TEST_CASE(
-    "Sets the size and capacity of the vector to 0, and deallocates the "
-    "allocated memory of the vector.",
+    "Sets the size of the vector to 0 while keeping its allocated memory.",
     "[Clear]") {
   Vector<int> vector{1, 2, 3, 4, 5};
 
   REQUIRE(vector.Size() == 5);
   REQUIRE(vector.Capacity() == 5);
 
+  const int* buffer = vector.Data();
   vector.Clear();
 
+  REQUIRE(vector.Size() == 0);
+  REQUIRE(vector.Capacity() == 5);
+  REQUIRE(vector.Data() == buffer);
+
+  SECTION("Releases the elements the vector held.") {
+    Vector<std::string> words{std::string(100, 'a'), std::string(100, 'b')};
+
+    words.Clear();
+    words.PushBack("c");
+
+    REQUIRE(words.Size() == 1);
+    REQUIRE(words.Capacity() == 2);
+    REQUIRE(words[0] == "c");
+  }
+
+  SECTION("Shrinks only after staying far below capacity.") {
+    Vector<int> buffer(1024);
+    buffer.SetShrinkPolicy(4, 3);
+    buffer.Clear();
+
+    for (int i = 0; i < 2; i++) {
+      buffer.PushBack(1);
+      buffer.Clear();
+    }
+
+    REQUIRE(buffer.Capacity() == 1024);
+
+    for (int i = 0; i < 1000; i++) {
+      buffer.PushBack(i);
+    }
+
+    buffer.Clear();
+    buffer.PushBack(1);
+    buffer.Clear();
+
+    REQUIRE(buffer.Capacity() == 1024);
+
+    buffer.Clear();
+    buffer.Clear();
+
+    REQUIRE(buffer.Capacity() == 512);
+    REQUIRE(buffer.Size() == 0);
+  }
+
+  SECTION("Moves and swaps keep the shrink policy with the elements.") {
+    Vector<int> source(64);
+    source.SetShrinkPolicy(2, 1);
+
+    Vector<int> moved(std::move(source));
+    Vector<int> assigned;
+    assigned = Vector<int>(std::move(moved));
+    Vector<int> swapped(64);
+    swapped.Swap(assigned);
+
+    for (int i = 0; i < 2; i++) {
+      assigned.Clear();
+      swapped.Clear();
+    }
+
+    REQUIRE(assigned.Capacity() == 64);
+    REQUIRE(swapped.Capacity() == 32);
+  }
+}
+
+TEST_CASE(
+    "Sets the size and capacity of the vector to 0, and deallocates the "
+    "allocated memory of the vector.",
+    "[Release]") {
+  Vector<int> vector{1, 2, 3, 4, 5};
+
+  vector.Release();
+
   REQUIRE(vector.Size() == 0);
   REQUIRE(vector.Capacity() == 0);
   REQUIRE(vector.Data() == nullptr);
+
+  vector.PushBack(6);
+
+  REQUIRE(vector.Size() == 1);
+  REQUIRE(vector[0] == 6);
+}
+
+struct CachedRecord {
+  int id;
+  float score;
+};
+
+template <>
+inline constexpr bool EnableVectorBufferCache<CachedRecord> = true;
+
+TEST_CASE("Recycles freed buffers of opted-in types on the same thread.",
+          "[Buffer Cache]") {
+  using Cache = VectorBufferCache<CachedRecord>;
+
+  static_assert(Cache::Enabled);
+  static_assert(!VectorBufferCache<int>::Enabled);
+  static_assert(!VectorBufferCache<std::string>::Enabled);
+
+  Cache::Trim();
+
+  SECTION("Serves a request from a buffer of the same size class.") {
+    const CachedRecord* first;
+
+    {
+      Vector<CachedRecord> vector(100);
+      first = vector.Data();
+    }
+
+    REQUIRE(Cache::CachedBuffers() == 1);
+
+    Vector<CachedRecord> vector(120);
+
+    REQUIRE(vector.Data() == first);
+    REQUIRE(vector.Capacity() == 120);
+    REQUIRE(Cache::CachedBuffers() == 0);
+  }
+
+  SECTION("Recycles the buffers left behind while growing.") {
+    Vector<CachedRecord> vector;
+
+    for (int i = 0; i < 1000; i++) {
+      vector.PushBack({i, 0.5f});
+    }
+
+    int cached = Cache::CachedBuffers();
+    Vector<CachedRecord> other;
+
+    for (int i = 0; i < 1000; i++) {
+      other.PushBack({i, 0.5f});
+    }
+
+    REQUIRE(cached > 0);
+    REQUIRE(Cache::CachedBuffers() == cached);
+    REQUIRE(other[999].id == 999);
+  }
+
+  SECTION("Caps each size class and trims on request.") {
+    {
+      Vector<Vector<CachedRecord>> vectors;
+
+      for (int i = 0; i < 20; i++) {
+        vectors.EmplaceBack(64);
+      }
+    }
+
+    REQUIRE(Cache::CachedBuffers() == Cache::MaxBuffersPerClass / 2);
+
+    Cache::SetLimit(2);
+
+    REQUIRE(Cache::CachedBuffers() == 2);
+
+    Cache::Trim();
+    Cache::SetLimit(Cache::MaxBuffersPerClass / 2);
+
+    REQUIRE(Cache::CachedBuffers() == 0);
+  }
+
+  Cache::Trim();
+}
+
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0;
+  int deallocations = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    allocations++;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, std::size_t bytes,
+                     std::size_t alignment) override {
+    deallocations++;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST_CASE("Allocates from a polymorphic memory resource.",
+          "[Memory Resource]") {
+  SECTION("Takes every buffer from the resource it was given.") {
+    std::byte arena[4096];
+    std::pmr::monotonic_buffer_resource monotonic(arena, sizeof(arena));
+    Vector<int> vector(&monotonic);
+
+    for (int i = 0; i < 100; i++) {
+      vector.PushBack(i);
+    }
+
+    auto address = reinterpret_cast<const std::byte*>(vector.Data());
+
+    REQUIRE(vector.Resource() == &monotonic);
+    REQUIRE(address >= arena);
+    REQUIRE(address < arena + sizeof(arena));
+    REQUIRE(vector[99] == 99);
+  }
+
+  SECTION("Returns every buffer to the resource.") {
+    CountingResource counting;
+
+    {
+      Vector<std::string> words({"a", "b", "c"}, &counting);
+      Vector<std::string> copy(words, &counting);
+
+      words.PushBack(std::string(50, 'd'));
+      copy.Release();
+
+      REQUIRE(counting.allocations == 3);
+      REQUIRE(counting.deallocations == 2);
+      REQUIRE(words[3] == std::string(50, 'd'));
+    }
+
+    REQUIRE(counting.deallocations == counting.allocations);
+  }
+
+  SECTION("Carries the resource on move and keeps it on assignment.") {
+    CountingResource first;
+    CountingResource second;
+    Vector<int> source(4, 7, &first);
+    Vector<int> moved(std::move(source));
+
+    REQUIRE(moved.Resource() == &first);
+    REQUIRE(first.allocations == 1);
+
+    Vector<int> target(&second);
+    target = std::move(moved);
+
+    REQUIRE(target.Resource() == &second);
+    REQUIRE(target.Size() == 4);
+    REQUIRE(target[3] == 7);
+    REQUIRE(first.deallocations == 1);
+    REQUIRE(second.allocations == 1);
+
+    Vector<int> other{1, 2};
+    target.Swap(other);
+
+    REQUIRE(target.Resource() == &second);
+    REQUIRE(other.Resource() == nullptr);
+    REQUIRE(target.Size() == 2);
+    REQUIRE(other.Size() == 4);
+  }
+
+  SECTION("Keeps each resource when swapping Vectors of different sizes.") {
+    CountingResource first;
+    CountingResource second;
+
+    {
+      Vector<int> a({1}, &first);
+      Vector<int> b({1, 2, 3}, &second);
+
+      a.Swap(b);
+
+      REQUIRE(a.Resource() == &first);
+      REQUIRE(b.Resource() == &second);
+      REQUIRE(a.Size() == 3);
+      REQUIRE(a[2] == 3);
+      REQUIRE(b.Size() == 1);
+      REQUIRE(b[0] == 1);
+
+      Vector<int> c({7, 8}, &first);
+      const int* bufferA = a.Data();
+      c.Swap(a);
+
+      REQUIRE(c.Data() == bufferA);
+      REQUIRE(c.Size() == 3);
+      REQUIRE(a.Size() == 2);
+      REQUIRE(a[1] == 8);
+    }
+
+    REQUIRE(first.deallocations == first.allocations);
+    REQUIRE(second.deallocations == second.allocations);
+  }
 }
 
 TEST_CASE(
@@ -1088,410 +1529,1881 @@ TEST_CASE("Sorts the Vector using Merge Sort.", "[Sort]") {
   REQUIRE(vector[4] == 5);
 }
 
-TEST_CASE("Reverses the Vector.", "[Reverse]") {
-  Vector<int> vector{1, 4, 3, 5, 2};
+TEST_CASE("Sorts arithmetic Vectors above the threshold with a radix sort.",
+          "[Radix Sort]") {
+  SECTION("Sorts signed integers, including negative values.") {
+    Vector<int> vector;
+    std::vector<int> expected;
+    WyRand generator(11);
 
-  REQUIRE(vector[0] == 1);
-  REQUIRE(vector[1] == 4);
-  REQUIRE(vector[2] == 3);
-  REQUIRE(vector[3] == 5);
-  REQUIRE(vector[4] == 2);
+    for (int i = 0; i < 5000; i++) {
+      int value = static_cast<int>(generator());
+      vector.PushBack(value);
+      expected.push_back(value);
+    }
 
-  vector.Reverse();
+    vector.Sort();
+    std::sort(expected.begin(), expected.end());
 
-  REQUIRE(vector[0] == 2);
-  REQUIRE(vector[1] == 5);
-  REQUIRE(vector[2] == 3);
-  REQUIRE(vector[3] == 4);
-  REQUIRE(vector[4] == 1);
-}
+    REQUIRE(vector == Vector<int>(expected));
+  }
 
-TEST_CASE(
-    "Removes the proved index from the Vector, and returns true; otherwise "
-    "returns false.",
-    "[Remove Index If]") {
-  SECTION("Returns false when the list is empty.") {
-    Vector<int> vector;
+  SECTION("Sorts 64 bit unsigned integers.") {
+    Vector<std::uint64_t> vector;
+    std::vector<std::uint64_t> expected;
+    WyRand generator(12);
 
-    bool removed = vector.RemoveIndexIf(2, [](const int& number) {
-      if (number > 2) {
-        return true;
-      }
+    for (int i = 0; i < 5000; i++) {
+      std::uint64_t value = generator() >> (i % 64);
+      vector.PushBack(value);
+      expected.push_back(value);
+    }
 
-      return false;
-    });
+    vector.Sort();
+    std::sort(expected.begin(), expected.end());
 
-    REQUIRE(removed == false);
+    REQUIRE(vector == Vector<std::uint64_t>(expected));
   }
 
-  SECTION(
-      "Returns false when no element in the Vector suffices the provided "
-      "function. No element is removed from the Vector.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("Sorts floating point values of both signs.") {
+    Vector<double> vector;
+    std::vector<double> expected;
+    WyRand generator(13);
 
-    bool removed = vector.RemoveIndexIf(0, [](const int& number) {
-      if (number == 10) {
-        return true;
-      }
-      return false;
-    });
+    for (int i = 0; i < 5000; i++) {
+      double value = (OpenUnitRandom(generator) - 0.5) * 1e6;
+      vector.PushBack(value);
+      expected.push_back(value);
+    }
 
-    REQUIRE(removed == false);
+    vector.PushBack(-0.0);
+    expected.push_back(-0.0);
+    vector.Sort();
+    std::sort(expected.begin(), expected.end());
+
+    REQUIRE(vector == Vector<double>(expected));
   }
 
-  SECTION(
-      "Returns true and removes the element at the provided index in the "
-      "Vector.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("Sorts records by an integer key, keeping equal keys in order.") {
+    Vector<std::pair<int, int>> vector;
 
-    bool removed = vector.RemoveIndexIf(0, [](const int& number) {
-      if (number < 5) {
-        return true;
-      }
+    for (int i = 0; i < 1000; i++) {
+      vector.PushBack({(i * 7919) % 100 - 50, i});
+    }
 
-      return false;
+    vector.SortByKey([](const std::pair<int, int>& record) {
+      return record.first;
     });
 
-    REQUIRE(removed == true);
+    bool sorted = true;
+
+    for (int i = 1; i < vector.Size(); i++) {
+      if (vector[i - 1].first > vector[i].first ||
+          (vector[i - 1].first == vector[i].first &&
+           vector[i - 1].second > vector[i].second)) {
+        sorted = false;
+      }
+    }
+
+    REQUIRE(sorted);
+    REQUIRE(vector.Front().first == -50);
   }
 }
 
-TEST_CASE(
-    "Applies a transformation to every element in the Vector, based on the "
-    "passed in Function.",
-    "[For Each]") {
-  Vector<int> vector{1, 2, 3, 4, 5};
+TEST_CASE("Selects order statistics without fully sorting the Vector.",
+          "[Selection]") {
+  SECTION("Places the k-th smallest element at index k.") {
+    Vector<int> vector;
+    std::vector<int> expected;
+    WyRand generator(21);
 
-  REQUIRE(vector[0] == 1);
-  REQUIRE(vector[1] == 2);
-  REQUIRE(vector[2] == 3);
-  REQUIRE(vector[3] == 4);
-  REQUIRE(vector[4] == 5);
+    for (int i = 0; i < 5000; i++) {
+      int value = static_cast<int>(BoundedRandom(generator, 1000));
+      vector.PushBack(value);
+      expected.push_back(value);
+    }
 
-  vector.ForEach([](const int& number, int) { return number + 10; });
+    std::sort(expected.begin(), expected.end());
 
-  REQUIRE(vector[0] == 11);
-  REQUIRE(vector[1] == 12);
-  REQUIRE(vector[2] == 13);
-  REQUIRE(vector[3] == 14);
-  REQUIRE(vector[4] == 15);
-}
+    for (int k : {0, 17, 2500, 4999}) {
+      vector.NthElement(k);
 
-TEST_CASE(
-    "Returns true if any of the elements in the Vector, suffice the passed in "
-    "Function.",
-    "[Any]") {
-  SECTION(
-      "Returns false if no elements in the Vector Suffice the passed in "
-      "Function.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+      bool partitioned = true;
 
-    bool any = vector.Any([](const int& number, int) {
-      if (number > 100) {
-        return true;
+      for (int i = 0; i < vector.Size(); i++) {
+        if ((i < k && vector[i] > vector[k]) ||
+            (i > k && vector[i] < vector[k])) {
+          partitioned = false;
+        }
       }
 
-      return false;
-    });
-
-    REQUIRE(any == false);
+      REQUIRE(vector[k] == expected[k]);
+      REQUIRE(partitioned);
+    }
   }
 
-  SECTION(
-      "Returns true if any elements in the Vector Suffice the passed in "
-      "Function.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("Survives inputs that defeat median of three pivots.") {
+    Vector<int> vector;
 
-    bool any = vector.Any([](const int& number, int) {
-      if (number > 4) {
-        return true;
-      }
+    for (int i = 0; i < 4096; i++) {
+      vector.PushBack(i % 2 == 0 ? i : 4096 - i);
+    }
 
-      return false;
-    });
+    vector.NthElement(2048);
 
-    REQUIRE(any == true);
-  }
-}
+    Vector<int> sorted(vector);
+    sorted.Sort();
 
-TEST_CASE(
-    "Returns true if all of the elements in the Vector, suffice the passed in "
-    "Function.",
-    "[Any]") {
-  SECTION(
-      "Returns false if no elements in the Vector Suffice the passed in "
-      "Function.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+    REQUIRE(vector[2048] == sorted[2048]);
+  }
 
-    bool every = vector.Every([](const int& number, int) {
-      if (number > 100) {
-        return true;
-      }
+  SECTION("Sorts only the first k elements.") {
+    Vector<int> vector{9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
 
-      return false;
-    });
+    vector.PartialSort(4);
 
-    REQUIRE(every == false);
+    REQUIRE(vector[0] == 0);
+    REQUIRE(vector[1] == 1);
+    REQUIRE(vector[2] == 2);
+    REQUIRE(vector[3] == 3);
+
+    vector.PartialSort(3, std::greater<int>());
+
+    REQUIRE(vector[0] == 9);
+    REQUIRE(vector[1] == 8);
+    REQUIRE(vector[2] == 7);
+  }
+
+  SECTION("Returns the k largest elements, leaving the Vector untouched.") {
+    Vector<int> vector{5, 1, 9, 3, 7, 2, 8};
+
+    Vector<int> largest = vector.TopK(3);
+    Vector<int> smallest = vector.TopK(2, std::less<int>());
+
+    REQUIRE(largest == Vector<int>{9, 8, 7});
+    REQUIRE(smallest == Vector<int>{1, 2});
+    REQUIRE(vector.TopK(20).Size() == 7);
+    REQUIRE(vector.TopK(0).Empty());
+    REQUIRE(vector[0] == 5);
+    REQUIRE(vector[6] == 8);
+  }
+
+  SECTION("Computes the median and interpolated percentiles.") {
+    Vector<int> odd{7, 1, 5, 3, 9};
+    Vector<int> even{4, 1, 3, 2};
+    Vector<double> values{10.0, 40.0, 20.0, 30.0};
+
+    REQUIRE(odd.Median() == 5.0);
+    REQUIRE(even.Median() == 2.5);
+    REQUIRE(values.Percentile(0.0) == 10.0);
+    REQUIRE(values.Percentile(100.0) == 40.0);
+    REQUIRE(values.Percentile(50.0) == 25.0);
+    REQUIRE(values.Percentile(25.0) == Approx(17.5));
+  }
+}
+
+TEST_CASE("Sorts parallel Vectors by one key through a permutation.",
+          "[Arg Sort]") {
+  SECTION("Returns the stable sorting permutation.") {
+    Vector<int> keys{30, 10, 20, 10};
+    Vector<int> order = keys.ArgSort();
+
+    REQUIRE(order[0] == 1);
+    REQUIRE(order[1] == 3);
+    REQUIRE(order[2] == 2);
+    REQUIRE(order[3] == 0);
+
+    Vector<int> descending = keys.ArgSort(std::greater<int>());
+
+    REQUIRE(descending[0] == 0);
+    REQUIRE(descending[1] == 2);
+  }
+
+  SECTION("Reorders several columns in place by one sorted key.") {
+    Vector<double> keys;
+    Vector<int> ids;
+    Vector<std::string> names;
+    WyRand generator(31);
+
+    for (int i = 0; i < 2000; i++) {
+      keys.PushBack(static_cast<double>(BoundedRandom(generator, 500)));
+      ids.PushBack(i);
+      names.PushBack(std::to_string(i));
+    }
+
+    Vector<double> original(keys);
+    Vector<int> order = keys.ArgSort();
+
+    keys.ApplyPermutation(order);
+    ids.ApplyPermutation(order);
+    names.ApplyPermutation(order);
+
+    bool consistent = true;
+
+    for (int i = 0; i < keys.Size(); i++) {
+      if (keys[i] != original[ids[i]] || names[i] != std::to_string(ids[i]) ||
+          (i > 0 && (keys[i - 1] > keys[i] ||
+                     (keys[i - 1] == keys[i] && ids[i - 1] > ids[i])))) {
+        consistent = false;
+      }
+    }
+
+    REQUIRE(consistent);
+  }
+}
+
+TEST_CASE("Combines sorted Vectors as sets.", "[Set Operations]") {
+  SECTION("Removes adjacent duplicates and returns how many were removed.") {
+    Vector<int> vector{1, 1, 2, 3, 3, 3, 4};
+    Vector<int> empty;
+
+    REQUIRE(vector.Unique() == 3);
+    REQUIRE(vector.Size() == 4);
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[1] == 2);
+    REQUIRE(vector[2] == 3);
+    REQUIRE(vector[3] == 4);
+    REQUIRE(empty.Unique() == 0);
+  }
+
+  SECTION("Builds the union, intersection and difference.") {
+    Vector<int> left{1, 2, 2, 4, 6};
+    Vector<int> right{2, 3, 4, 7};
+    Vector<std::string> words{"ant", "bee", "cat"};
+    Vector<std::string> others{"bee", "dog"};
+
+    std::vector<int> expected;
+    std::set_union(left.begin(), left.end(), right.begin(), right.end(),
+                   std::back_inserter(expected));
+    Vector<int> combined = left.SetUnion(right);
+    REQUIRE(std::vector<int>(combined.begin(), combined.end()) == expected);
+
+    expected.clear();
+    std::set_intersection(left.begin(), left.end(), right.begin(),
+                          right.end(), std::back_inserter(expected));
+    Vector<int> common = left.SetIntersection(right);
+    REQUIRE(std::vector<int>(common.begin(), common.end()) == expected);
+
+    expected.clear();
+    std::set_difference(left.begin(), left.end(), right.begin(), right.end(),
+                        std::back_inserter(expected));
+    Vector<int> remaining = left.SetDifference(right);
+    REQUIRE(std::vector<int>(remaining.begin(), remaining.end()) ==
+            expected);
+
+    REQUIRE(words.SetUnion(others).Size() == 4);
+    REQUIRE(words.SetIntersection(others)[0] == "bee");
+    REQUIRE(words.SetDifference(others).Size() == 2);
+    REQUIRE(words.SetDifference(others)[1] == "cat");
+  }
+
+  SECTION("Gallops through lopsided inputs with the same results.") {
+    Vector<int> large;
+    Vector<int> small{-5, 3, 300, 301, 9999, 100000};
+
+    for (int i = 0; i < 20000; i++) {
+      large.PushBack(i * 3);
+    }
+
+    std::vector<int> expected;
+    std::set_intersection(small.begin(), small.end(), large.begin(),
+                          large.end(), std::back_inserter(expected));
+
+    Vector<int> intersection = large.SetIntersection(small);
+    Vector<int> difference = small.SetDifference(large);
+
+    REQUIRE(std::vector<int>(intersection.begin(), intersection.end()) ==
+            expected);
+    REQUIRE(difference.Size() == 3);
+    REQUIRE(difference[0] == -5);
+    REQUIRE(difference[1] == 301);
+    REQUIRE(difference[2] == 100000);
+    REQUIRE(large.Includes(Vector<int>{3, 300, 9999}));
+    REQUIRE_FALSE(large.Includes(small));
+    REQUIRE(large.Includes(Vector<int>()));
+    REQUIRE(Vector<int>{1, 2, 2, 3}.Includes(Vector<int>{2, 2}));
+    REQUIRE_FALSE(Vector<int>{1, 2, 3}.Includes(Vector<int>{2, 2}));
+  }
+
+  SECTION("Stays within bounds when a NaN breaks the ordering.") {
+    double nan = std::nan("");
+    Vector<double> left{1, nan, 3};
+    Vector<double> right{2, 3};
+
+    Vector<double> combined = left.SetUnion(right);
+    Vector<double> common = left.SetIntersection(right);
+    Vector<double> remaining = left.SetDifference(right);
+
+    REQUIRE(combined.Size() <= left.Size() + right.Size());
+    REQUIRE(common.Size() <= right.Size());
+    REQUIRE(remaining.Size() <= left.Size());
+    REQUIRE(combined[0] == 1);
+    REQUIRE(remaining[0] == 1);
+  }
+
+  SECTION("Copies matching elements from the left operand.") {
+    struct Tagged {
+      int key;
+      char tag;
+
+      bool operator<(const Tagged& other) const { return key < other.key; }
+    };
+
+    Vector<Tagged> left{{1, 'l'}, {4, 'l'}};
+    Vector<Tagged> right{{1, 'r'}, {2, 'r'}, {4, 'r'}};
+    Vector<Tagged> many;
+
+    for (int i = 0; i < 200; i++) {
+      many.PushBack({i, 'm'});
+    }
+
+    Vector<Tagged> common = left.SetIntersection(right);
+    Vector<Tagged> lopsided = many.SetIntersection(left);
+    Vector<Tagged> reversed = left.SetIntersection(many);
+
+    REQUIRE(common.Size() == 2);
+    REQUIRE(common[0].tag == 'l');
+    REQUIRE(common[1].tag == 'l');
+    REQUIRE(lopsided.Size() == 2);
+    REQUIRE(lopsided[1].tag == 'm');
+    REQUIRE(reversed[1].tag == 'l');
+  }
+}
+
+TEST_CASE("Compares Vectors lexicographically.", "[Comparison]") {
+  SECTION("Orders byte keys like memcmp, with prefixes first.") {
+    Vector<std::uint8_t> key{1, 2, 200};
+    Vector<std::uint8_t> larger{1, 3};
+    Vector<std::uint8_t> prefix{1, 2};
+
+    REQUIRE(key < larger);
+    REQUIRE(prefix < key);
+    REQUIRE(key > prefix);
+    REQUIRE(key <= Vector<std::uint8_t>{1, 2, 200});
+    REQUIRE(key >= Vector<std::uint8_t>{1, 2, 200});
+    REQUIRE((key <=> larger) == std::strong_ordering::less);
+    REQUIRE((Vector<std::uint8_t>() <=> Vector<std::uint8_t>()) ==
+            std::strong_ordering::equal);
+  }
+
+  SECTION("Orders signed and floating point elements by value.") {
+    Vector<int> negative{-1, 5};
+    Vector<int> positive{1};
+    Vector<double> values;
+    Vector<double> changed;
+
+    for (int i = 0; i < 100; i++) {
+      values.PushBack(i * 0.5);
+      changed.PushBack(i == 70 ? 34.0 : i * 0.5);
+    }
+
+    Vector<double> withNaN{1.0, std::nan("")};
+
+    REQUIRE(negative < positive);
+    REQUIRE(values != changed);
+    REQUIRE(changed < values);
+    REQUIRE((values <=> values) == std::partial_ordering::equivalent);
+    REQUIRE((withNaN <=> withNaN) == std::partial_ordering::unordered);
+    REQUIRE_FALSE(withNaN == withNaN);
+  }
+
+  SECTION("Orders elements that only provide a less than operator.") {
+    struct Legacy {
+      int value;
+
+      bool operator<(const Legacy& other) const { return value < other.value; }
+    };
+
+    Vector<Legacy> small{Legacy{1}, Legacy{2}};
+    Vector<Legacy> large{Legacy{1}, Legacy{3}};
+
+    REQUIRE((small < large));
+    REQUIRE((small <= large));
+    REQUIRE((large > small));
+    REQUIRE((large >= small));
+  }
+}
+
+TEST_CASE("Hashes the contents of the Vector.", "[Hash]") {
+  SECTION("Hashes equal contents equally, regardless of capacity.") {
+    Vector<std::uint32_t> features{3, 1, 4, 1, 5};
+    Vector<std::uint32_t> copy;
+    Vector<std::string> words{"a", "bc"};
+    Vector<std::string> joined{"ab", "c"};
+
+    copy.Reserve(64);
+
+    for (std::uint32_t feature : features) {
+      copy.PushBack(feature);
+    }
+
+    REQUIRE(features.Hash() == copy.Hash());
+    REQUIRE(std::hash<Vector<std::uint32_t>>()(features) == features.Hash());
+    REQUIRE(features.Hash() != Vector<std::uint32_t>{3, 1, 4, 1}.Hash());
+    REQUIRE(words.Hash() != joined.Hash());
+  }
+
+  SECTION("Spreads similar keys across the hash space.") {
+    std::unordered_set<std::size_t> hashes;
+    std::unordered_set<std::size_t> lowBytes;
+
+    for (std::uint32_t i = 0; i < 10000; i++) {
+      Vector<std::uint32_t> key{i, i + 1, 7};
+      std::size_t hash = key.Hash();
+      hashes.insert(hash);
+      lowBytes.insert(hash & 0xff);
+    }
+
+    REQUIRE(hashes.size() == 10000);
+    REQUIRE(lowBytes.size() == 256);
+  }
+
+  SECTION("Keys unordered containers.") {
+    std::unordered_map<Vector<std::uint32_t>, int> counts;
+
+    counts[Vector<std::uint32_t>{1, 2}]++;
+    counts[Vector<std::uint32_t>{1, 2}]++;
+    counts[Vector<std::uint32_t>{2, 1}]++;
+
+    REQUIRE(counts.size() == 2);
+    REQUIRE(counts[Vector<std::uint32_t>{1, 2}] == 2);
+  }
+}
+
+TEST_CASE("Reduces the elements of the Vector.", "[Reductions]") {
+  SECTION("Sums integers without overflowing the element type.") {
+    Vector<std::uint8_t> bytes(1000, 200);
+    Vector<int> values;
+
+    for (int i = 1; i <= 1003; i++) {
+      values.PushBack(i % 2 == 0 ? i : -i);
+    }
+
+    REQUIRE(bytes.Sum() == 200000);
+    REQUIRE(values.Sum() == -502);
+    REQUIRE(Vector<int>().Sum() == 0);
+  }
+
+  SECTION("Sums floats with compensated and pairwise modes.") {
+    Vector<float> values(1 << 22, 0.1f);
+    double expected = 0.1f * static_cast<double>(1 << 22);
+
+    REQUIRE(values.Sum(SumMode::Kahan) == Approx(expected).epsilon(1e-6));
+    REQUIRE(values.Sum(SumMode::Pairwise) == Approx(expected).epsilon(1e-6));
+  }
+
+  SECTION("Finds the extremes and where they first occur.") {
+    Vector<double> values;
+
+    for (int i = 0; i < 1000; i++) {
+      values.PushBack(static_cast<double>((i * 37) % 1000) - 500.0);
+    }
+
+    MinMaxResult<double> extremes = values.MinMax();
+
+    REQUIRE(values.Min() == -500.0);
+    REQUIRE(values.Max() == 499.0);
+    REQUIRE(extremes.min == -500.0);
+    REQUIRE(extremes.max == 499.0);
+    REQUIRE(extremes.minIndex == 0);
+    REQUIRE(values[extremes.maxIndex] == 499.0);
+  }
+
+  SECTION("Skips NaNs wherever they appear when finding the extremes.") {
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    Vector<double> leading{nan, 3.0, -1.0, 7.0, 2.0};
+    Vector<double> middle;
+
+    for (int i = 0; i < 20; i++) {
+      middle.PushBack(i % 5 == 2 ? nan : static_cast<double>(i));
+    }
+
+    MinMaxResult<double> first = leading.MinMax();
+    MinMaxResult<double> inner = middle.MinMax();
+    MinMaxResult<double> none = Vector<double>{nan, nan, nan}.MinMax();
+
+    REQUIRE(leading.Min() == -1.0);
+    REQUIRE(leading.Max() == 7.0);
+    REQUIRE(first.min == -1.0);
+    REQUIRE(first.max == 7.0);
+    REQUIRE(first.minIndex == 2);
+    REQUIRE(first.maxIndex == 3);
+    REQUIRE(inner.min == 0.0);
+    REQUIRE(inner.max == 19.0);
+    REQUIRE(inner.minIndex == 0);
+    REQUIRE(inner.maxIndex == 19);
+    REQUIRE(std::isnan(none.min));
+    REQUIRE(std::isnan(none.max));
+    REQUIRE(none.minIndex == 0);
+    REQUIRE(none.maxIndex == 0);
+  }
+
+  SECTION("Reports the first index of repeated extremes.") {
+    Vector<int> values(40, 5);
+    values[13] = 1;
+    values[29] = 1;
+    values[6] = 9;
+    values[38] = 9;
+
+    MinMaxResult<int> extremes = values.MinMax();
+
+    REQUIRE(extremes.minIndex == 13);
+    REQUIRE(extremes.maxIndex == 6);
+  }
+
+  SECTION("Computes the mean and population variance.") {
+    Vector<int> values{2, 4, 4, 4, 5, 5, 7, 9};
+
+    REQUIRE(values.Mean() == 5.0);
+    REQUIRE(values.Variance() == 4.0);
+  }
+
+  SECTION("Counts matching elements.") {
+    Vector<int> values;
+    Vector<std::string> words{"a", "b", "a"};
+
+    for (int i = 0; i < 100; i++) {
+      values.PushBack(i % 3);
+    }
+
+    REQUIRE(values.Count(0) == 34);
+    REQUIRE(values.CountIf([](int value) { return value > 0; }) == 66);
+    REQUIRE(words.Count("a") == 2);
+  }
+}
+
+TEST_CASE("Reverses the Vector.", "[Reverse]") {
+  Vector<int> vector{1, 4, 3, 5, 2};
+
+  REQUIRE(vector[0] == 1);
+  REQUIRE(vector[1] == 4);
+  REQUIRE(vector[2] == 3);
+  REQUIRE(vector[3] == 5);
+  REQUIRE(vector[4] == 2);
+
+  vector.Reverse();
+
+  REQUIRE(vector[0] == 2);
+  REQUIRE(vector[1] == 5);
+  REQUIRE(vector[2] == 3);
+  REQUIRE(vector[3] == 4);
+  REQUIRE(vector[4] == 1);
+}
+
+TEST_CASE(
+    "Removes the proved index from the Vector, and returns true; otherwise "
+    "returns false.",
+    "[Remove Index If]") {
+  SECTION("Returns false when the list is empty.") {
+    Vector<int> vector;
+
+    bool removed = vector.RemoveIndexIf(2, [](const int& number) {
+      if (number > 2) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(removed == false);
+  }
+
+  SECTION(
+      "Returns false when no element in the Vector suffices the provided "
+      "function. No element is removed from the Vector.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool removed = vector.RemoveIndexIf(0, [](const int& number) {
+      if (number == 10) {
+        return true;
+      }
+      return false;
+    });
+
+    REQUIRE(removed == false);
+  }
+
+  SECTION(
+      "Returns true and removes the element at the provided index in the "
+      "Vector.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool removed = vector.RemoveIndexIf(0, [](const int& number) {
+      if (number < 5) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(removed == true);
+  }
+}
+
+TEST_CASE(
+    "Applies a transformation to every element in the Vector, based on the "
+    "passed in Function.",
+    "[For Each]") {
+  Vector<int> vector{1, 2, 3, 4, 5};
+
+  REQUIRE(vector[0] == 1);
+  REQUIRE(vector[1] == 2);
+  REQUIRE(vector[2] == 3);
+  REQUIRE(vector[3] == 4);
+  REQUIRE(vector[4] == 5);
+
+  vector.ForEach([](const int& number, int) { return number + 10; });
+
+  REQUIRE(vector[0] == 11);
+  REQUIRE(vector[1] == 12);
+  REQUIRE(vector[2] == 13);
+  REQUIRE(vector[3] == 14);
+  REQUIRE(vector[4] == 15);
+}
+
+TEST_CASE(
+    "Returns true if any of the elements in the Vector, suffice the passed in "
+    "Function.",
+    "[Any]") {
+  SECTION(
+      "Returns false if no elements in the Vector Suffice the passed in "
+      "Function.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool any = vector.Any([](const int& number, int) {
+      if (number > 100) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(any == false);
+  }
+
+  SECTION(
+      "Returns true if any elements in the Vector Suffice the passed in "
+      "Function.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool any = vector.Any([](const int& number, int) {
+      if (number > 4) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(any == true);
+  }
+}
+
+TEST_CASE(
+    "Returns true if all of the elements in the Vector, suffice the passed in "
+    "Function.",
+    "[Any]") {
+  SECTION(
+      "Returns false if no elements in the Vector Suffice the passed in "
+      "Function.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool every = vector.Every([](const int& number, int) {
+      if (number > 100) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(every == false);
+  }
+
+  SECTION(
+      "Returns false if even one element does not suffice the passed in "
+      "function.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool every = vector.Every([](const int& number, int) {
+      if (number > 1) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(every == false);
+  }
+
+  SECTION(
+      "Returns true if all elements in the Vector suffice the passed in "
+      "function.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    bool every = vector.Every([](const int& number, int) {
+      if (number < 10) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(every == true);
+  }
+}
+
+TEST_CASE("Shuffles the elements of the Vector.", "[Shuffle]") {
+  SECTION("Shuffling reorders the elements.") {
+    Vector<int> vectorOne{1, 2, 3, 4, 5};
+    Vector<int> vectorTwo{1, 2, 3, 4, 5};
+    WyRand generator(42);
+
+    REQUIRE(vectorOne == vectorTwo);
+
+    vectorOne.Shuffle(generator);
+
+    REQUIRE(vectorOne != vectorTwo);
+  }
+
+  SECTION("The same seed produces the same permutation.") {
+    Vector<int> vectorOne{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    Vector<int> vectorTwo{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    Xoshiro256 generatorOne(7);
+    Xoshiro256 generatorTwo(7);
+
+    vectorOne.Shuffle(generatorOne);
+    vectorTwo.Shuffle(generatorTwo);
+
+    REQUIRE(vectorOne == vectorTwo);
+  }
+
+  SECTION("Narrow standard generators shuffle differently for each seed.") {
+    Vector<int> vectorOne{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    Vector<int> vectorTwo{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::mt19937 generatorOne(1);
+    std::mt19937 generatorTwo(2);
+    std::minstd_rand sampler(99);
+
+    vectorOne.Shuffle(generatorOne);
+    vectorTwo.Shuffle(generatorTwo);
+    Vector<int> sample = vectorOne.Sample(3, sampler);
+
+    REQUIRE(vectorOne != vectorTwo);
+    REQUIRE(sample.Size() == 3);
+    REQUIRE(sample != Vector<int>{vectorOne[0], vectorOne[1], vectorOne[2]});
+  }
+
+  SECTION("Every permutation is equally likely.") {
+    WyRand generator(1);
+    int counts[6] = {0, 0, 0, 0, 0, 0};
+
+    for (int i = 0; i < 60000; i++) {
+      Vector<int> vector{0, 1, 2};
+      vector.Shuffle(generator);
+      counts[vector[0] * 2 + (vector[1] > vector[2] ? 1 : 0)]++;
+    }
+
+    for (int count : counts) {
+      REQUIRE(count > 9500);
+      REQUIRE(count < 10500);
+    }
+  }
+
+  SECTION("The parallel shuffle produces a permutation of the elements.") {
+    Vector<int> vector;
+    WyRand generator(3);
+
+    for (int i = 0; i < 200000; i++) {
+      vector.PushBack(i);
+    }
+
+    vector.ParallelShuffle(generator, 4);
+
+    REQUIRE(vector.Size() == 200000);
+    REQUIRE(vector[0] + vector[1] + vector[2] != 3);
+
+    std::sort(vector.begin(), vector.end());
+
+    bool isPermutation = true;
+
+    for (int i = 0; i < 200000; i++) {
+      if (vector[i] != i) {
+        isPermutation = false;
+      }
+    }
+
+    REQUIRE(isPermutation);
+  }
+}
+
+TEST_CASE("Samples elements of the Vector uniformly.", "[Sample]") {
+  SECTION("Returns the requested amount of distinct elements.") {
+    Vector<int> vector;
+    WyRand generator(5);
+
+    for (int i = 0; i < 1000; i++) {
+      vector.PushBack(i);
+    }
+
+    Vector<int> sample = vector.Sample(10, generator);
+    std::sort(sample.begin(), sample.end());
+
+    REQUIRE(sample.Size() == 10);
+
+    for (int i = 1; i < sample.Size(); i++) {
+      REQUIRE(sample[i - 1] < sample[i]);
+    }
+  }
+
+  SECTION("Every element is equally likely to be sampled.") {
+    Vector<int> vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    WyRand generator(9);
+    int counts[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    for (int i = 0; i < 20000; i++) {
+      Vector<int> sample = vector.Sample(2, generator);
+      counts[sample[0]]++;
+      counts[sample[1]]++;
+    }
+
+    for (int count : counts) {
+      REQUIRE(count > 3700);
+      REQUIRE(count < 4300);
+    }
+  }
+
+  SECTION("Asking for more elements than the Vector holds returns them all.") {
+    Vector<int> vector{1, 2, 3};
+
+    REQUIRE(vector.Sample(5).Size() == 3);
+  }
+}
+
+TEST_CASE(
+    "Swaps the data of two memebers of type T. Takes in two T pointers to swap "
+    "the elements in place.",
+    "[Swap Elements]") {
+  Vector<int> vector{1, 2, 3, 4, 5};
+
+  REQUIRE(vector[0] == 1);
+  REQUIRE(vector[1] == 2);
+  REQUIRE(vector[2] == 3);
+  REQUIRE(vector[3] == 4);
+  REQUIRE(vector[4] == 5);
+
+  vector.Swap(&vector[0], &vector[4]);
+
+  REQUIRE(vector[0] == 5);
+  REQUIRE(vector[1] == 2);
+  REQUIRE(vector[2] == 3);
+  REQUIRE(vector[3] == 4);
+  REQUIRE(vector[4] == 1);
+}
+
+TEST_CASE("Swaps the elements of two Vectors.", "[Swap Vectors]") {
+  SECTION("Swaps the Vectors when the first vector has more elements.") {
+    Vector<int> vectorOne{1, 2, 3, 4, 5};
+    Vector<int> vectorTwo{1, 2};
+
+    REQUIRE(vectorOne[0] == 1);
+    REQUIRE(vectorOne[1] == 2);
+    REQUIRE(vectorOne[2] == 3);
+    REQUIRE(vectorOne[3] == 4);
+    REQUIRE(vectorOne[4] == 5);
+
+    REQUIRE(vectorTwo[0] == 1);
+    REQUIRE(vectorTwo[1] == 2);
+
+    REQUIRE(vectorOne.Size() == 5);
+    REQUIRE(vectorTwo.Size() == 2);
+
+    vectorOne.Swap(vectorTwo);
+
+    REQUIRE(vectorTwo[0] == 1);
+    REQUIRE(vectorTwo[1] == 2);
+    REQUIRE(vectorTwo[2] == 3);
+    REQUIRE(vectorTwo[3] == 4);
+    REQUIRE(vectorTwo[4] == 5);
+
+    REQUIRE(vectorOne[0] == 1);
+    REQUIRE(vectorOne[1] == 2);
+
+    REQUIRE(vectorOne.Size() == 2);
+    REQUIRE(vectorTwo.Size() == 5);
+  }
+
+  SECTION("Swaps the vectors when both the vectors have the same length.") {
+    Vector<int> vectorOne{1, 2, 3};
+    Vector<int> vectorTwo{6, 7, 8};
+
+    REQUIRE(vectorOne[0] == 1);
+    REQUIRE(vectorOne[1] == 2);
+    REQUIRE(vectorOne[2] == 3);
+
+    REQUIRE(vectorTwo[0] == 6);
+    REQUIRE(vectorTwo[1] == 7);
+    REQUIRE(vectorTwo[2] == 8);
+
+    REQUIRE(vectorOne.Size() == 3);
+    REQUIRE(vectorTwo.Size() == 3);
+
+    vectorOne.Swap(vectorTwo);
+
+    REQUIRE(vectorTwo[0] == 1);
+    REQUIRE(vectorTwo[1] == 2);
+    REQUIRE(vectorTwo[2] == 3);
+
+    REQUIRE(vectorOne[0] == 6);
+    REQUIRE(vectorOne[1] == 7);
+    REQUIRE(vectorOne[2] == 8);
+
+    REQUIRE(vectorOne.Size() == 3);
+    REQUIRE(vectorTwo.Size() == 3);
+  }
+
+  SECTION("Swaps Vectors of different lengths.") {
+    Vector<int> vectorOne{1};
+    Vector<int> vectorTwo{4, 5, 6};
+    const int* bufferTwo = vectorTwo.Data();
+
+    vectorOne.Swap(vectorTwo);
+
+    REQUIRE(vectorOne.Size() == 3);
+    REQUIRE(vectorOne[0] == 4);
+    REQUIRE(vectorOne[2] == 6);
+    REQUIRE(vectorOne.Data() == bufferTwo);
+    REQUIRE(vectorTwo.Size() == 1);
+    REQUIRE(vectorTwo[0] == 1);
+  }
+}
+
+TEST_CASE("Concatenates one vector to the end of another.", "[Concat]") {
+  Vector<int> vectorOne{1, 2, 3, 4, 5};
+  Vector<int> vectorTwo{6, 7, 8, 9, 10};
+
+  REQUIRE(vectorOne[0] == 1);
+  REQUIRE(vectorOne[1] == 2);
+  REQUIRE(vectorOne[2] == 3);
+  REQUIRE(vectorOne[3] == 4);
+  REQUIRE(vectorOne[4] == 5);
+
+  REQUIRE(vectorTwo[0] == 6);
+  REQUIRE(vectorTwo[1] == 7);
+  REQUIRE(vectorTwo[2] == 8);
+  REQUIRE(vectorTwo[3] == 9);
+  REQUIRE(vectorTwo[4] == 10);
+
+  vectorOne.Concat(vectorTwo);
+
+  REQUIRE(vectorOne[0] == 1);
+  REQUIRE(vectorOne[1] == 2);
+  REQUIRE(vectorOne[2] == 3);
+  REQUIRE(vectorOne[3] == 4);
+  REQUIRE(vectorOne[4] == 5);
+  REQUIRE(vectorOne[5] == 6);
+  REQUIRE(vectorOne[6] == 7);
+  REQUIRE(vectorOne[7] == 8);
+  REQUIRE(vectorOne[8] == 9);
+  REQUIRE(vectorOne[9] == 10);
+}
+
+TEST_CASE("Returns the amount of free capacity the vector has available.",
+          "[Free Capacity]") {
+  Vector<int> vector{1, 2, 3, 4, 5};
+
+  REQUIRE(vector.Size() == 5);
+  REQUIRE(vector.Capacity() == 5);
+  REQUIRE(vector.FreeCapacity() == 0);
+
+  vector.PushBack(6);
+
+  REQUIRE(vector.Size() == 6);
+  REQUIRE(vector.Capacity() == 10);
+  REQUIRE(vector.FreeCapacity() == 4);
+
+  vector.Reserve(20);
+
+  REQUIRE(vector.Size() == 6);
+  REQUIRE(vector.Capacity() == 20);
+  REQUIRE(vector.FreeCapacity() == 14);
+}
+
+TEST_CASE(
+    "Removes elements in the Vector which suffice the passed in Function. "
+    "Returns the amount of elements which were removed.",
+    "[Remove If]") {
+  SECTION("Returns 0 if the list is empty.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    REQUIRE(vector.Size() == 5);
+
+    int amountRemoved = vector.RemoveIf([](const int& number) {
+      if (number > 10) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(amountRemoved == 0);
+    REQUIRE(vector.Size() == 5);
+  }
+
+  SECTION(
+      "Returns the amount of elements removed, and removes the elements which "
+      "suffice the passed in function.") {
+    Vector<int> vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    REQUIRE(vector.Size() == 10);
+    REQUIRE(vector.Capacity() == 10);
+    REQUIRE(vector.FreeCapacity() == 0);
+
+    int amountRemoved = vector.RemoveIf([](const int& number) {
+      if (number % 2 == 0) {
+        return true;
+      }
+
+      return false;
+    });
+
+    REQUIRE(vector.Size() == 5);
+    REQUIRE(vector.Capacity() == 10);
+    REQUIRE(vector.FreeCapacity() == 5);
+
+    REQUIRE(amountRemoved == 5);
+
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[1] == 3);
+    REQUIRE(vector[2] == 5);
+    REQUIRE(vector[3] == 7);
+    REQUIRE(vector[4] == 9);
+  }
+}
+
+TEST_CASE(
+    "Returns the index of the element with matching data, otherwise returns "
+    "-1.",
+    "[Binary Search]") {
+  SECTION(
+      "Returns -1 if no element in the Vector matches the passed in data.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    int index = vector.BinarySeach(12);
+
+    REQUIRE(index == -1);
+  }
+
+  SECTION(
+      "Returns the index of the element whose data matches the passed in "
+      "data.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    int index = vector.BinarySeach(1);
+
+    REQUIRE(index == 0);
+
+    index = vector.BinarySeach(5);
+
+    REQUIRE(index == 4);
+
+    index = vector.BinarySeach(3);
+
+    REQUIRE(index == 2);
+  }
+}
+
+TEST_CASE("Packs flags into words and answers bit queries.", "[Bit Vector]") {
+  SECTION("Reads and writes single bits through references.") {
+    BitVector bits(70);
+
+    bits[3] = true;
+    bits[69] = bits[3];
+    bits.Flip(64);
+    bits[3].Flip();
+
+    REQUIRE_FALSE(bits[3]);
+    REQUIRE(bits.Test(64));
+    REQUIRE(bits.Test(69));
+    REQUIRE(bits.Count() == 2);
+    REQUIRE(bits.WordCount() == 2);
+
+    bits.PushBack(true);
+    bits.PopBack();
+    bits.Resize(130, true);
+
+    REQUIRE(bits.Size() == 130);
+    REQUIRE(bits.Count() == 62);
+    REQUIRE(bits.Test(129));
+
+    bits.Resize(65);
+
+    REQUIRE(bits.Count() == 1);
+    REQUIRE(bits.FindFirst() == 64);
+  }
+
+  SECTION("Counts and finds set bits across word boundaries.") {
+    BitVector bits(300);
+    BitVector all(300, true);
+
+    for (int i = 0; i < 300; i += 7) {
+      bits.Set(i);
+    }
+
+    std::vector<int> positions;
+    bits.ForEachSetBit([&positions](int index) { positions.push_back(index); });
+
+    REQUIRE(bits.Count() == 43);
+    REQUIRE(all.All());
+    REQUIRE(all.Count() == 300);
+    REQUIRE(bits.FindFirst() == 0);
+    REQUIRE(bits.FindNext(0) == 7);
+    REQUIRE(bits.FindNext(62) == 63);
+    REQUIRE(bits.FindNext(294) == -1);
+    REQUIRE(BitVector(10).FindFirst() == -1);
+    REQUIRE(positions.size() == 43);
+    REQUIRE(positions.back() == 294);
+  }
+
+  SECTION("Answers rank and select with and without the index.") {
+    BitVector bits(2000);
+
+    for (int i = 0; i < 2000; i += 3) {
+      bits.Set(i);
+    }
+
+    bool unindexed = bits.Rank(1000) == 334 && bits.Select(333) == 999 &&
+                     bits.Select(667) == -1;
+    bits.BuildRankIndex();
+
+    bool consistent = true;
+
+    for (int i = 0; i <= 2000; i++) {
+      consistent = consistent && bits.Rank(i) == (i + 2) / 3;
+    }
+
+    for (int k = 0; k < 667; k++) {
+      consistent = consistent && bits.Select(k) == k * 3;
+    }
+
+    REQUIRE(unindexed);
+    REQUIRE(consistent);
+    REQUIRE(bits.Select(667) == -1);
+  }
+
+  SECTION("Combines bit vectors word by word.") {
+    BitVector evens(200);
+    BitVector threes(200);
+
+    for (int i = 0; i < 200; i++) {
+      evens.Set(i, i % 2 == 0);
+      threes.Set(i, i % 3 == 0);
+    }
+
+    BitVector both = evens;
+    both &= threes;
+    BitVector either = evens;
+    either |= threes;
+    BitVector exactlyOne = evens;
+    exactlyOne ^= threes;
+    BitVector onlyEven = evens;
+    onlyEven.AndNot(threes);
+
+    REQUIRE(both.Count() == 34);
+    REQUIRE(either.Count() == 133);
+    REQUIRE(exactlyOne.Count() == 99);
+    REQUIRE(onlyEven.Count() == 66);
+    REQUIRE(onlyEven.FindFirst() == 2);
+  }
+}
+
+TEST_CASE("Bit-packs integers in blocks with random access.",
+          "[Packed Int Vector]") {
+  SECTION("Packs each block to the width of its range.") {
+    PackedIntVector<std::uint64_t> ids;
+    auto id = [](int i) -> std::uint64_t {
+      return 5000000 + (i * 7919) % (1 << 20);
+    };
+
+    for (int i = 0; i < 1000; i++) {
+      ids.PushBack(id(i));
+    }
+
+    bool matches = true;
+
+    for (int i = 0; i < 1000; i++) {
+      matches = matches && ids[i] == id(i);
+    }
+
+    REQUIRE(matches);
+    REQUIRE(ids.Size() == 1000);
+    REQUIRE(ids.BlockCount() == 7);
+    REQUIRE(ids.BitsPerValue(0) <= 20);
+    REQUIRE(ids.Back() == id(999));
+  }
+
+  SECTION("Iterates and decodes in the order values were pushed.") {
+    Vector<long long> values;
+
+    for (int i = 0; i < 300; i++) {
+      values.PushBack(i % 5 == 0 ? -1000 - i : i * i);
+    }
+
+    values.PushBack(std::numeric_limits<long long>::max());
+    values.PushBack(std::numeric_limits<long long>::min());
+
+    PackedIntVector<long long> packed(values);
+    std::vector<long long> iterated(packed.begin(), packed.end());
+
+    REQUIRE(packed.ToVector() == values);
+    REQUIRE(iterated == std::vector<long long>(values.begin(), values.end()));
+  }
+
+  SECTION("Stores constant blocks in no bits.") {
+    PackedIntVector<int> packed;
+
+    for (int i = 0; i < 256; i++) {
+      packed.PushBack(42);
+    }
+
+    REQUIRE(packed.BitsPerValue(1) == 0);
+    REQUIRE(packed[200] == 42);
+
+    packed.PopBack();
+
+    REQUIRE(packed.Size() == 255);
+    REQUIRE(packed.BlockCount() == 1);
+    REQUIRE(packed.Back() == 42);
+
+    packed.Clear();
+
+    REQUIRE(packed.Empty());
+  }
+}
+
+TEST_CASE("Stores a Static Vector inline with a fixed capacity.",
+          "[Static Vector]") {
+  static_assert(std::is_trivially_copyable_v<StaticVector<int, 8>>);
+  static_assert(!std::is_trivially_copyable_v<StaticVector<std::string, 8>>);
+  static_assert(StaticVector<int, 8>::Capacity() == 8);
+  static_assert(sizeof(StaticVector<int, 8>) == sizeof(int) * 9);
+
+  SECTION("Refuses elements once it is full.") {
+    StaticVector<int, 4> vector{1, 2};
+
+    vector.PushBack(3);
+
+    REQUIRE(vector.TryPushBack(4));
+    REQUIRE(vector.Full());
+    REQUIRE_FALSE(vector.TryPushBack(5));
+    REQUIRE(vector.TryEmplaceBack(6) == nullptr);
+    REQUIRE(vector.Size() == 4);
+    REQUIRE(vector.Back() == 4);
+
+    vector.PopBack();
+
+    REQUIRE(vector.FreeCapacity() == 1);
+    REQUIRE(*vector.TryEmplaceBack(7) == 7);
+  }
+
+  SECTION("Copies trivially copyable elements with the object.") {
+    StaticVector<int, 4> vector{1, 2, 3};
+    StaticVector<int, 4> copy;
+
+    std::memcpy(static_cast<void*>(&copy), &vector, sizeof(vector));
+
+    REQUIRE(copy == vector);
+    REQUIRE(copy.Data() != vector.Data());
+    REQUIRE(std::accumulate(copy.begin(), copy.end(), 0) == 6);
+  }
+
+  SECTION("Constructs and destroys non-trivial elements in place.") {
+    StaticVector<std::string, 4> words{"b", "d"};
+
+    words.Insert(0, "a");
+    words.Insert(2, "c");
+
+    REQUIRE(words.Size() == 4);
+    REQUIRE(words[0] == "a");
+    REQUIRE(words[2] == "c");
+    REQUIRE(words.IndexOf("d") == 3);
+
+    StaticVector<std::string, 4> moved(std::move(words));
+    moved.Erase(1);
+
+    REQUIRE(words.Empty());
+    REQUIRE(moved.Size() == 3);
+    REQUIRE(moved[1] == "c");
+    REQUIRE(*moved.Find("d") == "d");
+  }
+}
+
+TEST_CASE("Shares the buffer of a Cow Vector until it is written to.",
+          "[Cow Vector]") {
+  SECTION("Copies share the same buffer.") {
+    CowVector<int> vectorOne{1, 2, 3, 4, 5};
+    CowVector<int> vectorTwo(vectorOne);
+
+    REQUIRE(vectorOne.UseCount() == 2);
+    REQUIRE(vectorTwo.UseCount() == 2);
+    REQUIRE(vectorOne.Read().Data() == vectorTwo.Read().Data());
+    REQUIRE(vectorOne == vectorTwo);
+  }
+
+  SECTION("Reading through a const Cow Vector does not detach.") {
+    CowVector<int> vectorOne{1, 2, 3, 4, 5};
+    const CowVector<int> vectorTwo = vectorOne;
+
+    REQUIRE(vectorTwo[0] == 1);
+    REQUIRE(vectorTwo.Back() == 5);
+    REQUIRE(vectorTwo.IndexOf(3) == 2);
+    REQUIRE(vectorOne.UseCount() == 2);
+  }
+
+  SECTION("The first mutation detaches the written copy only.") {
+    CowVector<int> vectorOne{1, 2, 3, 4, 5};
+    CowVector<int> vectorTwo = vectorOne;
+
+    vectorTwo.Set(0, 12);
+    vectorTwo.PushBack(6);
+
+    REQUIRE(vectorOne.UseCount() == 1);
+    REQUIRE(vectorTwo.UseCount() == 1);
+
+    REQUIRE(vectorOne.Size() == 5);
+    REQUIRE(vectorOne[0] == 1);
+
+    REQUIRE(vectorTwo.Size() == 6);
+    REQUIRE(vectorTwo[0] == 12);
+    REQUIRE(vectorTwo[5] == 6);
+  }
+
+  SECTION("Reads through a non-const Cow Vector do not detach.") {
+    STATIC_REQUIRE(std::is_same_v<decltype(std::declval<CowVector<int>&>()[0]),
+                                  const int&>);
+
+    CowVector<int> vectorOne{1, 2, 3};
+    CowVector<int> vectorTwo = vectorOne;
+
+    REQUIRE(vectorTwo[1] == 2);
+    REQUIRE(vectorTwo.Front() == 1);
+    REQUIRE(vectorTwo.Data() == vectorOne.Data());
+    REQUIRE(vectorOne.UseCount() == 2);
+  }
+
+  SECTION("Clearing a shared Cow Vector leaves the other copies intact.") {
+    CowVector<int> vectorOne{1, 2, 3};
+    CowVector<int> vectorTwo = vectorOne;
+
+    vectorTwo.Clear();
+
+    REQUIRE(vectorTwo.Size() == 0);
+    REQUIRE(vectorOne.Size() == 3);
+    REQUIRE(vectorOne.UseCount() == 1);
+  }
+}
+
+TEST_CASE("Iterates the Vector with contiguous iterators.", "[Iterators]") {
+  SECTION("The iterators model the standard iterator concepts.") {
+    STATIC_REQUIRE(std::contiguous_iterator<Vector<int>::Iterator>);
+    STATIC_REQUIRE(std::contiguous_iterator<Vector<int>::ConstIterator>);
+    STATIC_REQUIRE(
+        std::random_access_iterator<Vector<int>::ReverseIterator>);
+    STATIC_REQUIRE(std::ranges::contiguous_range<Vector<int>>);
+    STATIC_REQUIRE(std::ranges::contiguous_range<const Vector<int>>);
+  }
+
+  SECTION("Standard algorithms can be run over the iterators.") {
+    Vector<int> vector{5, 1, 4, 2, 3};
+
+    std::sort(vector.begin(), vector.end());
+
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[1] == 2);
+    REQUIRE(vector[2] == 3);
+    REQUIRE(vector[3] == 4);
+    REQUIRE(vector[4] == 5);
+
+    auto found = std::lower_bound(vector.cbegin(), vector.cend(), 4);
+
+    REQUIRE(found - vector.cbegin() == 3);
+    REQUIRE(*found == 4);
+  }
+
+  SECTION("A span can be built directly from the Vector.") {
+    Vector<int> vector{1, 2, 3};
+    std::span<int> span(vector.begin(), vector.end());
+    std::span<const int> constSpan(vector);
+
+    REQUIRE(span.data() == vector.Data());
+    REQUIRE(span.size() == 3);
+    REQUIRE(constSpan[2] == 3);
+  }
+
+  SECTION("Reverse iterators visit the elements from back to front.") {
+    const Vector<int> vector{1, 2, 3};
+    Vector<int> reversed;
+
+    for (auto it = vector.rbegin(); it != vector.rend(); ++it) {
+      reversed.PushBack(*it);
+    }
+
+    REQUIRE(reversed[0] == 3);
+    REQUIRE(reversed[1] == 2);
+    REQUIRE(reversed[2] == 1);
+    REQUIRE(vector.rbegin()[1] == 2);
+    REQUIRE(vector.rend() - vector.rbegin() == 3);
+  }
+}
+
+TEST_CASE("Builds lazy views over the storage of the Vector.", "[Views]") {
+  SECTION("Slices and spans alias the storage of the Vector.") {
+    Vector<int> vector{1, 2, 3, 4, 5};
+
+    std::span<int> span = vector.AsSpan();
+    auto slice = vector.Slice(1, 4);
+
+    STATIC_REQUIRE(std::ranges::view<decltype(slice)>);
+    REQUIRE(span.data() == vector.Data());
+    REQUIRE(slice.size() == 3);
+    REQUIRE(slice[0] == 2);
+
+    slice[0] = 12;
+
+    REQUIRE(vector[1] == 12);
+  }
+
+  SECTION("Map, Filter and Take are only evaluated when iterated.") {
+    Vector<int> vector{1, 2, 3, 4, 5, 6, 7, 8};
+    int calls = 0;
+
+    auto pipeline = vector.AsView()
+                        .Filter([](int number) { return number % 2 == 0; })
+                        .Map([&calls](int number) {
+                          calls++;
+                          return number * 10;
+                        })
+                        .Take(3);
+
+    REQUIRE(calls == 0);
+
+    Vector<int> collected = pipeline.Collect();
+
+    REQUIRE(calls == 3);
+    REQUIRE(collected.Size() == 3);
+    REQUIRE(collected[0] == 20);
+    REQUIRE(collected[1] == 40);
+    REQUIRE(collected[2] == 60);
   }
 
-  SECTION(
-      "Returns false if even one element does not suffice the passed in "
-      "function.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("Chunks splits the view into consecutive sub views.") {
+    const Vector<int> vector{1, 2, 3, 4, 5, 6, 7};
+    Vector<int> sums;
 
-    bool every = vector.Every([](const int& number, int) {
-      if (number > 1) {
-        return true;
+    for (auto chunk : vector.AsView().Chunks(3)) {
+      int sum = 0;
+
+      for (int number : chunk) {
+        sum += number;
       }
 
-      return false;
-    });
+      sums.PushBack(sum);
+    }
 
-    REQUIRE(every == false);
+    REQUIRE(sums.Size() == 3);
+    REQUIRE(sums[0] == 6);
+    REQUIRE(sums[1] == 15);
+    REQUIRE(sums[2] == 7);
   }
 
-  SECTION(
-      "Returns true if all elements in the Vector suffice the passed in "
-      "function.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("Collecting a Filter tests each element once.") {
+    Vector<int> vector{1, 2, 3, 4, 5, 6, 7};
+    int calls = 0;
 
-    bool every = vector.Every([](const int& number, int) {
-      if (number < 10) {
-        return true;
-      }
+    Vector<int> odd = vector.AsView()
+                          .Filter([&calls](int number) {
+                            calls++;
+                            return number % 2 != 0;
+                          })
+                          .Collect();
 
-      return false;
-    });
+    REQUIRE(calls == 7);
+    REQUIRE(odd.Size() == 4);
+    REQUIRE(odd[3] == 7);
+  }
 
-    REQUIRE(every == true);
+  SECTION("Collecting a sized view reserves the exact size once.") {
+    Vector<int> vector{1, 2, 3, 4, 5, 6, 7};
+
+    Vector<int> tens =
+        vector.AsView().Map([](int number) { return number * 10; }).Collect();
+
+    REQUIRE(tens.Size() == 7);
+    REQUIRE(tens.Capacity() == 7);
+    REQUIRE(tens[6] == 70);
   }
 }
 
-TEST_CASE("Shuffles the elements of the Vector.", "[Shuffle]") {
-  Vector<int> vectorOne{1, 2, 3, 4, 5};
-  Vector<int> vectorTwo{1, 2, 3, 4, 5};
+TEST_CASE("Stores every field of a row in its own contiguous array.",
+          "[Soa Vector]") {
+  SECTION("Rows are pushed field by field and read back through a proxy.") {
+    SoaVector<int, float, char> vector;
 
-  REQUIRE(vectorOne == vectorTwo);
+    vector.PushBack(1, 1.5f, 'a');
+    vector.EmplaceBack(2, 2.5f, 'b');
 
-  vectorOne.Shuffle();
+    REQUIRE(vector.Size() == 2);
+    REQUIRE(vector[0].Get<0>() == 1);
+    REQUIRE(vector[1].Get<1>() == 2.5f);
+    REQUIRE(vector[1].Get<2>() == 'b');
 
-  REQUIRE(vectorOne != vectorTwo);
-}
+    vector[0].Get<1>() = 4.0f;
 
-TEST_CASE(
-    "Swaps the data of two memebers of type T. Takes in two T pointers to swap "
-    "the elements in place.",
-    "[Swap Elements]") {
-  Vector<int> vector{1, 2, 3, 4, 5};
+    REQUIRE(vector.Data<1>()[0] == 4.0f);
+    REQUIRE(vector.Column<0>().size() == 2);
 
-  REQUIRE(vector[0] == 1);
-  REQUIRE(vector[1] == 2);
-  REQUIRE(vector[2] == 3);
-  REQUIRE(vector[3] == 4);
-  REQUIRE(vector[4] == 5);
+    vector.Column<2>()[1] = 'z';
 
-  vector.Swap(&vector[0], &vector[4]);
+    REQUIRE(vector[1].Get<2>() == 'z');
+    STATIC_REQUIRE(std::is_same_v<decltype(vector.Column<0>()),
+                                  std::span<int>>);
+  }
 
-  REQUIRE(vector[0] == 5);
-  REQUIRE(vector[1] == 2);
-  REQUIRE(vector[2] == 3);
-  REQUIRE(vector[3] == 4);
-  REQUIRE(vector[4] == 1);
-}
+  SECTION("Each field is stored contiguously.") {
+    SoaVector<int, double> vector;
 
-TEST_CASE("Swaps the elements of two Vectors.", "[Swap Vectors]") {
-  SECTION("Swaps the Vectors when the first vector has more elements.") {
-    Vector<int> vectorOne{1, 2, 3, 4, 5};
-    Vector<int> vectorTwo{1, 2};
+    for (int i = 0; i < 10; i++) {
+      vector.PushBack(i, i * 0.5);
+    }
 
-    REQUIRE(vectorOne[0] == 1);
-    REQUIRE(vectorOne[1] == 2);
-    REQUIRE(vectorOne[2] == 3);
-    REQUIRE(vectorOne[3] == 4);
-    REQUIRE(vectorOne[4] == 5);
+    const double* halves = vector.Data<1>();
 
-    REQUIRE(vectorTwo[0] == 1);
-    REQUIRE(vectorTwo[1] == 2);
+    for (int i = 0; i < 10; i++) {
+      REQUIRE(halves[i] == i * 0.5);
+    }
+  }
 
-    REQUIRE(vectorOne.Size() == 5);
-    REQUIRE(vectorTwo.Size() == 2);
+  SECTION("Erasing a row removes it from every field.") {
+    SoaVector<int, char> vector;
+    vector.PushBack(1, 'a');
+    vector.PushBack(2, 'b');
+    vector.PushBack(3, 'c');
 
-    vectorOne.Swap(vectorTwo);
+    vector.Erase(1);
 
-    REQUIRE(vectorTwo[0] == 1);
-    REQUIRE(vectorTwo[1] == 2);
-    REQUIRE(vectorTwo[2] == 3);
-    REQUIRE(vectorTwo[3] == 4);
-    REQUIRE(vectorTwo[4] == 5);
+    REQUIRE(vector.Size() == 2);
+    REQUIRE(vector.Row(1) == std::tuple<int, char>(3, 'c'));
+  }
 
-    REQUIRE(vectorOne[0] == 1);
-    REQUIRE(vectorOne[1] == 2);
+  SECTION("Sorting by one field reorders all the fields.") {
+    SoaVector<int, char> vector;
+    vector.PushBack(3, 'c');
+    vector.PushBack(1, 'a');
+    vector.PushBack(2, 'b');
 
-    REQUIRE(vectorOne.Size() == 2);
-    REQUIRE(vectorTwo.Size() == 5);
+    vector.SortBy<0>();
+    const SoaVector<int, char>& sorted = vector;
+
+    REQUIRE(sorted.Column<0>() == Vector<int>{1, 2, 3});
+    REQUIRE(sorted.Column<1>() == Vector<char>{'a', 'b', 'c'});
   }
+}
 
-  SECTION("Swaps the vectors when both the vectors have the same length.") {
-    Vector<int> vectorOne{1, 2, 3};
-    Vector<int> vectorTwo{6, 7, 8};
+TEST_CASE("Grows a Segmented Vector without moving existing elements.",
+          "[Segmented Vector]") {
+  SECTION("References stay valid while the vector grows.") {
+    SegmentedVector<int, 4> vector;
+    vector.PushBack(1);
 
-    REQUIRE(vectorOne[0] == 1);
-    REQUIRE(vectorOne[1] == 2);
-    REQUIRE(vectorOne[2] == 3);
+    int* first = &vector[0];
 
-    REQUIRE(vectorTwo[0] == 6);
-    REQUIRE(vectorTwo[1] == 7);
-    REQUIRE(vectorTwo[2] == 8);
+    for (int i = 2; i <= 100; i++) {
+      vector.PushBack(i);
+    }
 
-    REQUIRE(vectorOne.Size() == 3);
-    REQUIRE(vectorTwo.Size() == 3);
+    REQUIRE(first == &vector[0]);
+    REQUIRE(*first == 1);
+    REQUIRE(vector.Size() == 100);
+    REQUIRE(vector.Capacity() == 124);
+    REQUIRE(vector.BlockCount() == 5);
 
-    vectorOne.Swap(vectorTwo);
+    for (int i = 0; i < 100; i++) {
+      REQUIRE(vector[i] == i + 1);
+    }
+  }
 
-    REQUIRE(vectorTwo[0] == 1);
-    REQUIRE(vectorTwo[1] == 2);
-    REQUIRE(vectorTwo[2] == 3);
+  SECTION("Blocks grow geometrically and are visited in order.") {
+    SegmentedVector<int, 4> vector;
 
-    REQUIRE(vectorOne[0] == 6);
-    REQUIRE(vectorOne[1] == 7);
-    REQUIRE(vectorOne[2] == 8);
+    for (int i = 0; i < 20; i++) {
+      vector.PushBack(i);
+    }
 
-    REQUIRE(vectorOne.Size() == 3);
-    REQUIRE(vectorTwo.Size() == 3);
+    Vector<int> blockSizes;
+    int sum = 0;
+
+    vector.ForEachBlock([&](const int* block, int count) {
+      blockSizes.PushBack(count);
+
+      for (int i = 0; i < count; i++) {
+        sum += block[i];
+      }
+    });
+
+    REQUIRE(blockSizes == Vector<int>{4, 8, 8});
+    REQUIRE(sum == 190);
   }
-}
 
-TEST_CASE("Concatenates one vector to the end of another.", "[Concat]") {
-  Vector<int> vectorOne{1, 2, 3, 4, 5};
-  Vector<int> vectorTwo{6, 7, 8, 9, 10};
+  SECTION("Supports searching and standard algorithms.") {
+    SegmentedVector<int, 2> vector{5, 3, 9, 1, 7};
 
-  REQUIRE(vectorOne[0] == 1);
-  REQUIRE(vectorOne[1] == 2);
-  REQUIRE(vectorOne[2] == 3);
-  REQUIRE(vectorOne[3] == 4);
-  REQUIRE(vectorOne[4] == 5);
+    std::sort(vector.begin(), vector.end());
 
-  REQUIRE(vectorTwo[0] == 6);
-  REQUIRE(vectorTwo[1] == 7);
-  REQUIRE(vectorTwo[2] == 8);
-  REQUIRE(vectorTwo[3] == 9);
-  REQUIRE(vectorTwo[4] == 10);
+    REQUIRE(vector.Front() == 1);
+    REQUIRE(vector.Back() == 9);
+    REQUIRE(vector.IndexOf(7) == 3);
+    REQUIRE(vector.Find(12) == nullptr);
 
-  vectorOne.Concat(vectorTwo);
+    vector.PopBack();
 
-  REQUIRE(vectorOne[0] == 1);
-  REQUIRE(vectorOne[1] == 2);
-  REQUIRE(vectorOne[2] == 3);
-  REQUIRE(vectorOne[3] == 4);
-  REQUIRE(vectorOne[4] == 5);
-  REQUIRE(vectorOne[5] == 6);
-  REQUIRE(vectorOne[6] == 7);
-  REQUIRE(vectorOne[7] == 8);
-  REQUIRE(vectorOne[8] == 9);
-  REQUIRE(vectorOne[9] == 10);
+    REQUIRE(vector.Size() == 4);
+    REQUIRE(vector.Back() == 7);
+  }
 }
 
-TEST_CASE("Returns the amount of free capacity the vector has available.",
-          "[Free Capacity]") {
-  Vector<int> vector{1, 2, 3, 4, 5};
+struct MigrationTracked {
+  static inline int constructed = 0;
+  static inline int destroyed = 0;
 
-  REQUIRE(vector.Size() == 5);
-  REQUIRE(vector.Capacity() == 5);
-  REQUIRE(vector.FreeCapacity() == 0);
+  int value;
 
-  vector.PushBack(6);
+  MigrationTracked(int value) : value{value} { constructed++; }
 
-  REQUIRE(vector.Size() == 6);
-  REQUIRE(vector.Capacity() == 10);
-  REQUIRE(vector.FreeCapacity() == 4);
+  MigrationTracked(const MigrationTracked& other) : value{other.value} {
+    constructed++;
+  }
 
-  vector.Reserve(20);
+  MigrationTracked(MigrationTracked&& other) : value{other.value} {
+    constructed++;
+  }
 
-  REQUIRE(vector.Size() == 6);
-  REQUIRE(vector.Capacity() == 20);
-  REQUIRE(vector.FreeCapacity() == 14);
-}
+  MigrationTracked& operator=(const MigrationTracked&) = default;
+  MigrationTracked& operator=(MigrationTracked&&) = default;
 
-TEST_CASE(
-    "Removes elements in the Vector which suffice the passed in Function. "
-    "Returns the amount of elements which were removed.",
-    "[Remove If]") {
-  SECTION("Returns 0 if the list is empty.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  ~MigrationTracked() { destroyed++; }
+};
 
-    REQUIRE(vector.Size() == 5);
+TEST_CASE("Migrates the elements of an Incremental Vector in bounded steps.",
+          "[Incremental Vector]") {
+  SECTION("No single PushBack migrates more than the migration step.") {
+    IncrementalVector<int, 2> vector;
 
-    int amountRemoved = vector.RemoveIf([](const int& number) {
-      if (number > 10) {
-        return true;
+    for (int i = 0; i < 1000; i++) {
+      int pendingBefore = vector.PendingMigration();
+      bool migratingBefore = vector.Migrating();
+
+      vector.PushBack(i);
+
+      if (migratingBefore) {
+        REQUIRE(pendingBefore - vector.PendingMigration() <= 2);
       }
+    }
 
-      return false;
-    });
+    REQUIRE(vector.Size() == 1000);
 
-    REQUIRE(amountRemoved == 0);
-    REQUIRE(vector.Size() == 5);
+    for (int i = 0; i < 1000; i++) {
+      REQUIRE(vector[i] == i);
+    }
   }
 
-  SECTION(
-      "Returns the amount of elements removed, and removes the elements which "
-      "suffice the passed in function.") {
-    Vector<int> vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  SECTION("Reads are served from both buffers during a migration.") {
+    IncrementalVector<int, 1> vector{1, 2, 3, 4};
 
-    REQUIRE(vector.Size() == 10);
-    REQUIRE(vector.Capacity() == 10);
-    REQUIRE(vector.FreeCapacity() == 0);
+    vector.PushBack(5);
 
-    int amountRemoved = vector.RemoveIf([](const int& number) {
-      if (number % 2 == 0) {
-        return true;
+    REQUIRE(vector.Migrating());
+    REQUIRE(vector.Capacity() == 8);
+    REQUIRE(vector.PendingMigration() == 4);
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[4] == 5);
+
+    vector.PushBack(6);
+    vector[3] = 12;
+
+    REQUIRE(vector.PendingMigration() == 3);
+    REQUIRE(vector.Data()[3] == 12);
+    REQUIRE(!vector.Migrating());
+  }
+
+  SECTION("Constructs and destroys at most a step of elements per push.") {
+    MigrationTracked::constructed = 0;
+    MigrationTracked::destroyed = 0;
+    bool bounded = true;
+
+    {
+      IncrementalVector<MigrationTracked, 4> vector;
+
+      for (int i = 0; i < 3000; i++) {
+        int constructedBefore = MigrationTracked::constructed;
+        int destroyedBefore = MigrationTracked::destroyed;
+
+        vector.EmplaceBack(i);
+
+        bounded = bounded &&
+                  MigrationTracked::constructed - constructedBefore <= 5 &&
+                  MigrationTracked::destroyed - destroyedBefore <= 4;
       }
 
-      return false;
-    });
+      for (int i = 0; i < 1000; i++) {
+        vector.PopBack();
+      }
 
-    REQUIRE(vector.Size() == 5);
-    REQUIRE(vector.Capacity() == 10);
-    REQUIRE(vector.FreeCapacity() == 5);
+      REQUIRE(vector.Size() == 2000);
+      REQUIRE(vector[1999].value == 1999);
+    }
 
-    REQUIRE(amountRemoved == 5);
+    REQUIRE(bounded);
+    REQUIRE(MigrationTracked::constructed == MigrationTracked::destroyed);
+  }
 
-    REQUIRE(vector[0] == 1);
-    REQUIRE(vector[1] == 3);
-    REQUIRE(vector[2] == 5);
-    REQUIRE(vector[3] == 7);
-    REQUIRE(vector[4] == 9);
+  SECTION("Popping elements that were not migrated yet ends the migration.") {
+    IncrementalVector<int, 1> vector{1, 2};
+
+    vector.PushBack(3);
+    vector.PopBack();
+    vector.PopBack();
+
+    REQUIRE(!vector.Migrating());
+    REQUIRE(vector.Size() == 1);
+    REQUIRE(vector.Front() == 1);
   }
 }
 
-TEST_CASE(
-    "Returns the index of the element with matching data, otherwise returns "
-    "-1.",
-    "[Binary Search]") {
-  SECTION(
-      "Returns -1 if no element in the Vector matches the passed in data.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+TEST_CASE("Appends to a Concurrent Vector from many threads at once.",
+          "[Concurrent Vector]") {
+  SECTION("Every pushed element is published exactly once.") {
+    ConcurrentVector<int, 8> vector;
+    const int threadCount = 8;
+    const int perThread = 5000;
+    Vector<std::thread> threads;
 
-    int index = vector.BinarySeach(12);
+    for (int t = 0; t < threadCount; t++) {
+      threads.EmplaceBack([&vector, t, perThread]() {
+        for (int i = 0; i < perThread; i++) {
+          vector.PushBack(t * perThread + i);
+        }
+      });
+    }
 
-    REQUIRE(index == -1);
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    REQUIRE(vector.Size() == threadCount * perThread);
+
+    Vector<int> seen(threadCount * perThread, 0);
+
+    vector.ForEach([&seen](const int& number, int) { seen[number]++; });
+
+    REQUIRE(seen.Every([](const int& count, int) { return count == 1; }));
   }
 
-  SECTION(
-      "Returns the index of the element whose data matches the passed in "
-      "data.") {
-    Vector<int> vector{1, 2, 3, 4, 5};
+  SECTION("References stay valid while other elements are appended.") {
+    ConcurrentVector<int, 2> vector;
+    int index = vector.EmplaceBack(12);
+    int* first = &vector[index];
 
-    int index = vector.BinarySeach(1);
+    for (int i = 0; i < 100; i++) {
+      vector.PushBack(i);
+    }
 
-    REQUIRE(index == 0);
+    REQUIRE(first == &vector[0]);
+    REQUIRE(vector[0] == 12);
+    REQUIRE(vector[100] == 99);
+  }
+}
 
-    index = vector.BinarySeach(5);
+TEST_CASE("Publishes new versions of a Snapshot Vector to lock-free readers.",
+          "[Snapshot Vector]") {
+  SECTION("A snapshot keeps reading the version it was taken from.") {
+    SnapshotVector<int> table(Vector<int>{1, 2, 3});
 
-    REQUIRE(index == 4);
+    auto before = table.Read();
 
-    index = vector.BinarySeach(3);
+    table.Update([](Vector<int>& next) { next.PushBack(4); });
 
-    REQUIRE(index == 2);
+    auto after = table.Read();
+
+    REQUIRE(before.Size() == 3);
+    REQUIRE(after.Size() == 4);
+    REQUIRE(after.BinarySeach(4) == 3);
+    REQUIRE(before.Find(4) == nullptr);
+    REQUIRE(table.PendingReclamation() == 1);
+  }
+
+  SECTION("Old versions are reclaimed once no reader holds them.") {
+    SnapshotVector<int> table(Vector<int>{1});
+
+    {
+      auto snapshot = table.Read();
+      table.Publish(Vector<int>{2});
+      table.Publish(Vector<int>{3});
+
+      REQUIRE(snapshot[0] == 1);
+      REQUIRE(table.PendingReclamation() == 2);
+    }
+
+    REQUIRE(table.Reclaim() == 2);
+    REQUIRE(table.PendingReclamation() == 0);
+    REQUIRE(table.Read()[0] == 3);
+  }
+
+  SECTION("Reading with every slot held copies instead of waiting.") {
+    SnapshotVector<int, 2> table(Vector<int>{1, 2});
+    auto first = table.Read();
+    auto second = table.Read();
+    auto third = table.Read();
+
+    table.Publish(Vector<int>{3});
+
+    auto fourth = std::move(third);
+
+    REQUIRE(first[1] == 2);
+    REQUIRE(fourth.Size() == 2);
+    REQUIRE(&*fourth != &*first);
+    REQUIRE(table.Read()[0] == 3);
+    REQUIRE(table.PendingReclamation() == 1);
+  }
+
+  SECTION("Readers on other threads always see a complete version.") {
+    SnapshotVector<int> table(Vector<int>(16, 0));
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    Vector<std::thread> readers;
+
+    for (int t = 0; t < 4; t++) {
+      readers.EmplaceBack([&table, &done, &torn]() {
+        while (!done.load()) {
+          auto snapshot = table.Read();
+
+          for (int value : snapshot) {
+            if (value != snapshot[0]) {
+              torn++;
+            }
+          }
+        }
+      });
+    }
+
+    for (int version = 1; version <= 200; version++) {
+      table.Publish(Vector<int>(16, version));
+    }
+
+    done.store(true);
+
+    for (std::thread& reader : readers) {
+      reader.join();
+    }
+
+    REQUIRE(torn.load() == 0);
+    REQUIRE(table.Read()[15] == 200);
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,172 @@
+#ifndef _VECTORBUFFERCACHE_H_
+#define _VECTORBUFFERCACHE_H_
+
+#include <bit>
+#include <cassert>
+#include <type_traits>
+
+// Opt a type in by specializing this to true. Only trivial types qualify: a
+// recycled buffer still holds the previous values, which matches what new T[]
+// leaves in a buffer of trivial T.
+template <typename T>
+inline constexpr bool EnableVectorBufferCache = false;
+
+// A per-thread cache of freed Vector buffers. Requests up to MaxClassSize
+// elements are rounded up to a power of two and served from the free list of
+// that size class, so a thread that keeps creating and destroying vectors of
+// similar sizes stops reaching the allocator. Larger requests bypass it.
+template <typename T>
+class VectorBufferCache {
+ public:
+  static constexpr bool Enabled =
+      EnableVectorBufferCache<T> && std::is_trivial_v<T>;
+  static constexpr int ClassCount = 21;
+  static constexpr int MaxClassSize = 1 << (ClassCount - 1);
+  static constexpr int MaxBuffersPerClass = 16;
+
+ private:
+  T* buffers[ClassCount][MaxBuffersPerClass];
+  int counts[ClassCount];
+  int limit;
+
+ private:
+  VectorBufferCache() noexcept;
+  ~VectorBufferCache() noexcept;
+
+  static VectorBufferCache* Local();
+  static bool& Destroyed();
+  static int ClassOf(int count);
+  void FreeBeyond(int keep);
+
+ public:
+  VectorBufferCache(const VectorBufferCache&) = delete;
+  VectorBufferCache& operator=(const VectorBufferCache&) = delete;
+
+  static T* Allocate(int count);
+  static void Deallocate(T* buffer, int count);
+  static void SetLimit(int buffersPerClass);
+  static void Trim();
+  static int CachedBuffers();
+};
+
+template <typename T>
+VectorBufferCache<T>::VectorBufferCache() noexcept
+    : counts{}, limit{MaxBuffersPerClass / 2} {}
+
+template <typename T>
+VectorBufferCache<T>::~VectorBufferCache() noexcept {
+  this->FreeBeyond(0);
+  Destroyed() = true;
+}
+
+template <typename T>
+VectorBufferCache<T>* VectorBufferCache<T>::Local() {
+  // Vectors that outlive the thread's cache, such as statics destroyed after
+  // the main thread's thread_locals, fall back to plain new and delete.
+  if (Destroyed()) {
+    return nullptr;
+  }
+
+  thread_local VectorBufferCache cache;
+  return &cache;
+}
+
+template <typename T>
+bool& VectorBufferCache<T>::Destroyed() {
+  thread_local bool destroyed = false;
+  return destroyed;
+}
+
+template <typename T>
+int VectorBufferCache<T>::ClassOf(int count) {
+  return std::bit_width(static_cast<unsigned>(count - 1));
+}
+
+template <typename T>
+void VectorBufferCache<T>::FreeBeyond(int keep) {
+  for (int sizeClass = 0; sizeClass < ClassCount; sizeClass++) {
+    while (counts[sizeClass] > keep) {
+      delete[] buffers[sizeClass][--counts[sizeClass]];
+    }
+  }
+}
+
+template <typename T>
+T* VectorBufferCache<T>::Allocate(int count) {
+  assert(count > 0);
+
+  if (count > MaxClassSize) {
+    return new T[count];
+  }
+
+  int sizeClass = ClassOf(count);
+  VectorBufferCache* cache = Local();
+
+  if (cache != nullptr && cache->counts[sizeClass] > 0) {
+    return cache->buffers[sizeClass][--cache->counts[sizeClass]];
+  }
+
+  return new T[1 << sizeClass];
+}
+
+template <typename T>
+void VectorBufferCache<T>::Deallocate(T* buffer, int count) {
+  // count must be the one the buffer was allocated with, so it maps back to
+  // the same size class.
+  if (buffer == nullptr) {
+    return;
+  }
+
+  if (count > MaxClassSize) {
+    delete[] buffer;
+    return;
+  }
+
+  int sizeClass = ClassOf(count);
+  VectorBufferCache* cache = Local();
+
+  if (cache == nullptr || cache->counts[sizeClass] >= cache->limit) {
+    delete[] buffer;
+    return;
+  }
+
+  cache->buffers[sizeClass][cache->counts[sizeClass]++] = buffer;
+}
+
+template <typename T>
+void VectorBufferCache<T>::SetLimit(int buffersPerClass) {
+  assert(buffersPerClass >= 0);
+  assert(buffersPerClass <= MaxBuffersPerClass);
+  VectorBufferCache* cache = Local();
+
+  if (cache == nullptr) {
+    return;
+  }
+
+  cache->limit = buffersPerClass;
+  cache->FreeBeyond(buffersPerClass);
+}
+
+template <typename T>
+void VectorBufferCache<T>::Trim() {
+  VectorBufferCache* cache = Local();
+
+  if (cache != nullptr) {
+    cache->FreeBeyond(0);
+  }
+}
+
+template <typename T>
+int VectorBufferCache<T>::CachedBuffers() {
+  VectorBufferCache* cache = Local();
+  int total = 0;
+
+  for (int sizeClass = 0; cache != nullptr && sizeClass < ClassCount;
+       sizeClass++) {
+    total += cache->counts[sizeClass];
+  }
+
+  return total;
+}
+
+#endif  // _VECTORBUFFERCACHE_H_
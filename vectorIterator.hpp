@@ -1,58 +1,113 @@
 #ifndef _VECTORITERATOR_H_
 #define _VECTORITERATOR_H_
 
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
 template <typename Vector>
 class VectorIterator {
  public:
   using ValueType = typename Vector::ValueType;
-  using PointerType = ValueType*;
-  using ReferenceType = ValueType&;
+  using ElementType = std::conditional_t<std::is_const_v<Vector>,
+                                         const ValueType, ValueType>;
+  using PointerType = ElementType*;
+  using ReferenceType = ElementType&;
+  using DifferenceType = std::ptrdiff_t;
+
+  using iterator_concept = std::contiguous_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = ValueType;
+  using element_type = ElementType;
+  using difference_type = DifferenceType;
+  using pointer = PointerType;
+  using reference = ReferenceType;
+
+  constexpr VectorIterator() noexcept : data{nullptr} {}
 
-  explicit VectorIterator(PointerType ptr) : data{ptr} {}
+  explicit constexpr VectorIterator(PointerType ptr) noexcept : data{ptr} {}
 
  private:
   PointerType data;
 
  public:
-  VectorIterator& operator++() noexcept {
+  constexpr VectorIterator& operator++() noexcept {
     data++;
     return *this;
   }
 
-  VectorIterator operator++(int) noexcept {
+  constexpr VectorIterator operator++(int) noexcept {
     VectorIterator iterator(*this);
     ++data;
     return iterator;
   }
 
-  VectorIterator& operator--() noexcept {
+  constexpr VectorIterator& operator--() noexcept {
     --data;
     return *this;
   }
 
-  VectorIterator operator--(int) noexcept {
+  constexpr VectorIterator operator--(int) noexcept {
     VectorIterator iterator(*this);
     --data;
     return iterator;
   }
 
-  ReferenceType operator[](int index) { return *(data + index); }
+  constexpr VectorIterator& operator+=(DifferenceType offset) noexcept {
+    data += offset;
+    return *this;
+  }
+
+  constexpr VectorIterator& operator-=(DifferenceType offset) noexcept {
+    data -= offset;
+    return *this;
+  }
+
+  constexpr VectorIterator operator+(DifferenceType offset) const noexcept {
+    return VectorIterator(data + offset);
+  }
+
+  friend constexpr VectorIterator operator+(DifferenceType offset,
+                                  const VectorIterator& iterator) noexcept {
+    return VectorIterator(iterator.data + offset);
+  }
+
+  constexpr VectorIterator operator-(DifferenceType offset) const noexcept {
+    return VectorIterator(data - offset);
+  }
+
+  constexpr DifferenceType operator-(
+      const VectorIterator& other) const noexcept {
+    return data - other.data;
+  }
+
+  constexpr ReferenceType operator[](DifferenceType index) const {
+    return *(data + index);
+  }
 
-  PointerType operator->() const { return data; }
+  constexpr PointerType operator->() const { return data; }
 
-  ReferenceType operator*() const { return *data; }
+  constexpr ReferenceType operator*() const { return *data; }
 
-  bool operator==(const VectorIterator& other) const {
+  constexpr bool operator==(const VectorIterator& other) const {
     return data == other.data;
   }
 
-  bool operator!=(const VectorIterator& other) const {
+  constexpr bool operator!=(const VectorIterator& other) const {
     return !(data == other.data);
   }
 
-  operator VectorIterator<const VectorIterator>() const {
-    return VectorIterator<const VectorIterator>(data);
+  constexpr std::strong_ordering operator<=>(
+      const VectorIterator& other) const {
+    return data <=> other.data;
+  }
+
+  constexpr operator VectorIterator<const Vector>() const
+    requires(!std::is_const_v<Vector>)
+  {
+    return VectorIterator<const Vector>(data);
   }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,158 @@
+#ifndef _VECTORVIEW_H_
+#define _VECTORVIEW_H_
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+template <typename T>
+class Vector;
+
+template <typename Range>
+class ChunkView;
+
+template <typename Range>
+class VectorView : public std::ranges::view_interface<VectorView<Range>> {
+ public:
+  using ValueType = std::ranges::range_value_t<Range>;
+
+ private:
+  Range range;
+
+ public:
+  VectorView()
+    requires std::default_initializable<Range>
+  = default;
+
+  explicit VectorView(Range range) : range{std::move(range)} {}
+
+  auto begin() { return std::ranges::begin(range); }
+
+  auto end() { return std::ranges::end(range); }
+
+  auto begin() const
+    requires std::ranges::range<const Range>
+  {
+    return std::ranges::begin(range);
+  }
+
+  auto end() const
+    requires std::ranges::range<const Range>
+  {
+    return std::ranges::end(range);
+  }
+
+  template <typename Function>
+  auto Map(Function function) const {
+    using Mapped =
+        decltype(std::views::transform(Range(range), std::move(function)));
+    return VectorView<Mapped>(
+        std::views::transform(Range(range), std::move(function)));
+  }
+
+  template <typename Predicate>
+  auto Filter(Predicate predicate) const {
+    using Filtered =
+        decltype(std::views::filter(Range(range), std::move(predicate)));
+    return VectorView<Filtered>(
+        std::views::filter(Range(range), std::move(predicate)));
+  }
+
+  auto Take(int count) const {
+    using Taken = decltype(std::views::take(Range(range), count));
+    return VectorView<Taken>(std::views::take(Range(range), count));
+  }
+
+  auto Chunks(int count) const {
+    assert(count > 0);
+    return VectorView<ChunkView<Range>>(ChunkView<Range>(range, count));
+  }
+
+  Vector<ValueType> Collect() {
+    Vector<ValueType> result;
+
+    // Unsized pipelines (Filter) grow as they go instead of being counted
+    // first, which would run their predicates twice per element.
+    if constexpr (std::ranges::sized_range<Range>) {
+      result.Reserve(static_cast<int>(std::ranges::size(range)));
+    }
+
+    for (auto&& element : range) {
+      result.PushBack(std::forward<decltype(element)>(element));
+    }
+
+    return result;
+  }
+};
+
+template <typename Range>
+class ChunkView : public std::ranges::view_interface<ChunkView<Range>> {
+ private:
+  using BaseIterator = std::ranges::iterator_t<Range>;
+  using BaseSentinel = std::ranges::sentinel_t<Range>;
+  using Chunk = VectorView<std::ranges::subrange<BaseIterator>>;
+
+  Range range;
+  int count;
+
+ public:
+  class Iterator {
+   private:
+    BaseIterator current;
+    BaseIterator next;
+    BaseSentinel last;
+    int count;
+
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Chunk;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    Iterator(BaseIterator first, BaseSentinel last, int count)
+        : current{first},
+          next{std::ranges::next(first, count, last)},
+          last{last},
+          count{count} {}
+
+    Chunk operator*() const {
+      return Chunk(std::ranges::subrange<BaseIterator>(current, next));
+    }
+
+    Iterator& operator++() {
+      current = next;
+      next = std::ranges::next(next, count, last);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator iterator(*this);
+      ++*this;
+      return iterator;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return current == other.current;
+    }
+
+    bool operator==(std::default_sentinel_t) const { return current == last; }
+  };
+
+  ChunkView()
+    requires std::default_initializable<Range>
+  = default;
+
+  ChunkView(Range range, int count) : range{std::move(range)}, count{count} {}
+
+  Iterator begin() {
+    return Iterator(std::ranges::begin(range), std::ranges::end(range), count);
+  }
+
+  std::default_sentinel_t end() { return std::default_sentinel; }
+};
+
+#endif  // _VECTORVIEW_H_